@@ -1,2697 +0,0 @@
-#pragma once
-
-#include "tas5805m_eq.h"
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-    // 2 bands use to create 4-order filter, 1 more band to compensate the gain for HF filter
-    // 1: Chebyshev 2nd-order low-pass or high-pass filter
-    // 2: Chebyshev 2nd-order low-pass or high-pass filter
-    // 3: High Shelf
-
-#define TAS5805M_EQ_PROFILE_BANDS 3
-#define TAS5805M_EQ_PROFILE_REG_PER_STEP (TAS5805M_EQ_PROFILE_BANDS * TAS5805M_EQ_KOEF_PER_BAND * TAS5805M_EQ_REG_PER_KOEF)
-
-static const reg_sequence_eq tas5805m_eq_registers_left_flat[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x08}, //  Biquad -  BQ1 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x00},
-    {0x24, 0x1b, 0x00},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x00},
-    {0x24, 0x1f, 0x00},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x00},
-    {0x24, 0x23, 0x00},
-    {0x24, 0x24, 0x00},
-    {0x24, 0x25, 0x00},
-    {0x24, 0x26, 0x00},
-    {0x24, 0x27, 0x00},
-    {0x24, 0x28, 0x00},
-    {0x24, 0x29, 0x00},
-    {0x24, 0x2a, 0x00},
-    {0x24, 0x2b, 0x00},
-    {0x24, 0x2c, 0x08}, //  Biquad -  BQ2 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x00},
-    {0x24, 0x2f, 0x00},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x00},
-    {0x24, 0x33, 0x00},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x00},
-    {0x24, 0x37, 0x00},
-    {0x24, 0x38, 0x00},
-    {0x24, 0x39, 0x00},
-    {0x24, 0x3a, 0x00},
-    {0x24, 0x3b, 0x00},
-    {0x24, 0x3c, 0x00},
-    {0x24, 0x3d, 0x00},
-    {0x24, 0x3e, 0x00},
-    {0x24, 0x3f, 0x00},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_60[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 60 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x02},
-    {0x24, 0x1b, 0xe3},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x05},
-    {0x24, 0x1f, 0xc5},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x02},
-    {0x24, 0x23, 0xe3},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf4},
-    {0x24, 0x26, 0x84},
-    {0x24, 0x27, 0xcd},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0b},
-    {0x24, 0x2a, 0x6e},
-    {0x24, 0x2b, 0xfa},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 60 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x02},
-    {0x24, 0x2f, 0xe3},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x05},
-    {0x24, 0x33, 0xc5},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x02},
-    {0x24, 0x37, 0xe3},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf4},
-    {0x24, 0x3a, 0x84},
-    {0x24, 0x3b, 0xcd},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0b},
-    {0x24, 0x3e, 0x6e},
-    {0x24, 0x3f, 0xfa},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_70[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 70 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x03},
-    {0x24, 0x1b, 0xed},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x07},
-    {0x24, 0x1f, 0xda},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x03},
-    {0x24, 0x23, 0xed},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf2},
-    {0x24, 0x26, 0x9a},
-    {0x24, 0x27, 0x28},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0d},
-    {0x24, 0x2a, 0x55},
-    {0x24, 0x2b, 0x36},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 70 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x03},
-    {0x24, 0x2f, 0xed},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x07},
-    {0x24, 0x33, 0xda},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x03},
-    {0x24, 0x37, 0xed},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf2},
-    {0x24, 0x3a, 0x9a},
-    {0x24, 0x3b, 0x28},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0d},
-    {0x24, 0x3e, 0x55},
-    {0x24, 0x3f, 0x36},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_80[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 80 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x05},
-    {0x24, 0x1b, 0x20},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x0a},
-    {0x24, 0x1f, 0x40},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x05},
-    {0x24, 0x23, 0x20},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf0},
-    {0x24, 0x26, 0xaf},
-    {0x24, 0x27, 0x4c},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0f},
-    {0x24, 0x2a, 0x3a},
-    {0x24, 0x2b, 0xfe},
-    {0x24, 0x2c, 0x00}, // Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 80 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x05},
-    {0x24, 0x2f, 0x20},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x0a},
-    {0x24, 0x33, 0x40},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x05},
-    {0x24, 0x37, 0x20},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf0},
-    {0x24, 0x3a, 0xaf},
-    {0x24, 0x3b, 0x4c},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0f},
-    {0x24, 0x3e, 0x3a},
-    {0x24, 0x3f, 0xfe},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_90[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 90 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x06},
-    {0x24, 0x1b, 0x7c},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x0c},
-    {0x24, 0x1f, 0xf7},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x06},
-    {0x24, 0x23, 0x7c},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xee},
-    {0x24, 0x26, 0xc4},
-    {0x24, 0x27, 0x37},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x11},
-    {0x24, 0x2a, 0x20},
-    {0x24, 0x2b, 0x52},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 90 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x06},
-    {0x24, 0x2f, 0x7c},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x0c},
-    {0x24, 0x33, 0xf7},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x06},
-    {0x24, 0x37, 0x7c},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xee},
-    {0x24, 0x3a, 0xc4},
-    {0x24, 0x3b, 0x37},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x11},
-    {0x24, 0x3e, 0x20},
-    {0x24, 0x3f, 0x52},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_100[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 100 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x08},
-    {0x24, 0x1b, 0x00},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x10},
-    {0x24, 0x1f, 0x00},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x08},
-    {0x24, 0x23, 0x00},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xec},
-    {0x24, 0x26, 0xd8},
-    {0x24, 0x27, 0xea},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x13},
-    {0x24, 0x2a, 0x05},
-    {0x24, 0x2b, 0x31},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 100 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x08},
-    {0x24, 0x2f, 0x00},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x10},
-    {0x24, 0x33, 0x00},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x08},
-    {0x24, 0x37, 0x00},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xec},
-    {0x24, 0x3a, 0xd8},
-    {0x24, 0x3b, 0xea},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x13},
-    {0x24, 0x3e, 0x05},
-    {0x24, 0x3f, 0x31},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_110[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 110 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x09},
-    {0x24, 0x1b, 0xad},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x13},
-    {0x24, 0x1f, 0x59},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x09},
-    {0x24, 0x23, 0xad},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xea},
-    {0x24, 0x26, 0xed},
-    {0x24, 0x27, 0x66},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x14},
-    {0x24, 0x2a, 0xe9},
-    {0x24, 0x2b, 0x9c},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 110 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x09},
-    {0x24, 0x2f, 0xad},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x13},
-    {0x24, 0x33, 0x59},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x09},
-    {0x24, 0x37, 0xad},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xea},
-    {0x24, 0x3a, 0xed},
-    {0x24, 0x3b, 0x66},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x14},
-    {0x24, 0x3e, 0xe9},
-    {0x24, 0x3f, 0x9c},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_120[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, // Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 120 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x0b},
-    {0x24, 0x1b, 0x82},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x17},
-    {0x24, 0x1f, 0x04},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x0b},
-    {0x24, 0x23, 0x82},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xe9},
-    {0x24, 0x26, 0x01},
-    {0x24, 0x27, 0xaa},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x16},
-    {0x24, 0x2a, 0xcd},
-    {0x24, 0x2b, 0x93},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 120 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x0b},
-    {0x24, 0x2f, 0x82},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x17},
-    {0x24, 0x33, 0x04},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x0b},
-    {0x24, 0x37, 0x82},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xe9},
-    {0x24, 0x3a, 0x01},
-    {0x24, 0x3b, 0xaa},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x16},
-    {0x24, 0x3e, 0xcd},
-    {0x24, 0x3f, 0x93},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_130[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //   Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 130 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x0d},
-    {0x24, 0x1b, 0x80},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x1b},
-    {0x24, 0x1f, 0x00},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x0d},
-    {0x24, 0x23, 0x80},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xe7},
-    {0x24, 0x26, 0x15},
-    {0x24, 0x27, 0xb6},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x18},
-    {0x24, 0x2a, 0xb1},
-    {0x24, 0x2b, 0x16},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 130 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x0d},
-    {0x24, 0x2f, 0x80},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x1b},
-    {0x24, 0x33, 0x00},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x0d},
-    {0x24, 0x37, 0x80},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xe7},
-    {0x24, 0x3a, 0x15},
-    {0x24, 0x3b, 0xb6},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x18},
-    {0x24, 0x3e, 0xb1},
-    {0x24, 0x3f, 0x16},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_140[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 140 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x0f},
-    {0x24, 0x1b, 0xa6},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x1f},
-    {0x24, 0x1f, 0x4d},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x0f},
-    {0x24, 0x23, 0xa6},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xe5},
-    {0x24, 0x26, 0x29},
-    {0x24, 0x27, 0x8b},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x1a},
-    {0x24, 0x2a, 0x94},
-    {0x24, 0x2b, 0x26},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 140 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x0f},
-    {0x24, 0x2f, 0xa6},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x1f},
-    {0x24, 0x33, 0x4d},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x0f},
-    {0x24, 0x37, 0xa6},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xe5},
-    {0x24, 0x3a, 0x29},
-    {0x24, 0x3b, 0x8b},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x1a},
-    {0x24, 0x3e, 0x94},
-    {0x24, 0x3f, 0x26},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_lf_150[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x00}, //  Biquad -  BQ1 Left   -     Filter: Low Pass-Chebyshev  Frequency: 150 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x00},
-    {0x24, 0x1a, 0x11},
-    {0x24, 0x1b, 0xf5},
-    {0x24, 0x1c, 0x00},
-    {0x24, 0x1d, 0x00},
-    {0x24, 0x1e, 0x23},
-    {0x24, 0x1f, 0xea},
-    {0x24, 0x20, 0x00},
-    {0x24, 0x21, 0x00},
-    {0x24, 0x22, 0x11},
-    {0x24, 0x23, 0xf5},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xe3},
-    {0x24, 0x26, 0x3d},
-    {0x24, 0x27, 0x2a},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x1c},
-    {0x24, 0x2a, 0x76},
-    {0x24, 0x2b, 0xc1},
-    {0x24, 0x2c, 0x00}, //  Biquad -  BQ2 Left   -     Filter: Low Pass-Chebyshev  Frequency: 150 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x00},
-    {0x24, 0x2e, 0x11},
-    {0x24, 0x2f, 0xf5},
-    {0x24, 0x30, 0x00},
-    {0x24, 0x31, 0x00},
-    {0x24, 0x32, 0x23},
-    {0x24, 0x33, 0xea},
-    {0x24, 0x34, 0x00},
-    {0x24, 0x35, 0x00},
-    {0x24, 0x36, 0x11},
-    {0x24, 0x37, 0xf5},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xe3},
-    {0x24, 0x3a, 0x3d},
-    {0x24, 0x3b, 0x2a},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x1c},
-    {0x24, 0x3e, 0x76},
-    {0x24, 0x3f, 0xc1},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: All Pass  Frequency: 1000 Hz  QVal: 0.71  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0x00},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0x00},
-    {0x24, 0x44, 0x00},
-    {0x24, 0x45, 0x00},
-    {0x24, 0x46, 0x00},
-    {0x24, 0x47, 0x00},
-    {0x24, 0x48, 0x00},
-    {0x24, 0x49, 0x00},
-    {0x24, 0x4a, 0x00},
-    {0x24, 0x4b, 0x00},
-    {0x24, 0x4c, 0x00},
-    {0x24, 0x4d, 0x00},
-    {0x24, 0x4e, 0x00},
-    {0x24, 0x4f, 0x00},
-    {0x24, 0x50, 0x00},
-    {0x24, 0x51, 0x00},
-    {0x24, 0x52, 0x00},
-    {0x24, 0x53, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_60[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 60 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x89},
-    {0x24, 0x1a, 0xde},
-    {0x24, 0x1b, 0x6d},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xec},
-    {0x24, 0x1e, 0x43},
-    {0x24, 0x1f, 0x27},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x89},
-    {0x24, 0x22, 0xde},
-    {0x24, 0x23, 0x6d},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf8},
-    {0x24, 0x26, 0x6e},
-    {0x24, 0x27, 0x5f},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x07},
-    {0x24, 0x2a, 0x8c},
-    {0x24, 0x2b, 0x4f},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 60 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x89},
-    {0x24, 0x2e, 0xde},
-    {0x24, 0x2f, 0x6d},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xec},
-    {0x24, 0x32, 0x43},
-    {0x24, 0x33, 0x27},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x89},
-    {0x24, 0x36, 0xde},
-    {0x24, 0x37, 0x6d},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf8},
-    {0x24, 0x3a, 0x6e},
-    {0x24, 0x3b, 0x5f},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x07},
-    {0x24, 0x3e, 0x8c},
-    {0x24, 0x3f, 0x4f},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 200 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf8},
-    {0x24, 0x42, 0x2c},
-    {0x24, 0x43, 0x87},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x49},
-    {0x24, 0x46, 0xb1},
-    {0x24, 0x47, 0x28},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xbe},
-    {0x24, 0x4a, 0x80},
-    {0x24, 0x4b, 0x36},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xc9},
-    {0x24, 0x4e, 0x2f},
-    {0x24, 0x4f, 0xb1},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x36},
-    {0x24, 0x52, 0x72},
-    {0x24, 0x53, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_70[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 70 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x89},
-    {0x24, 0x1a, 0x46},
-    {0x24, 0x1b, 0x48},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xed},
-    {0x24, 0x1e, 0x73},
-    {0x24, 0x1f, 0x70},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x89},
-    {0x24, 0x22, 0x46},
-    {0x24, 0x23, 0x48},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf7},
-    {0x24, 0x26, 0x2b},
-    {0x24, 0x27, 0x18},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x08},
-    {0x24, 0x2a, 0xcd},
-    {0x24, 0x2b, 0xaa},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 70 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x89},
-    {0x24, 0x2e, 0x46},
-    {0x24, 0x2f, 0x48},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xed},
-    {0x24, 0x32, 0x73},
-    {0x24, 0x33, 0x70},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x89},
-    {0x24, 0x36, 0x46},
-    {0x24, 0x37, 0x48},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf7},
-    {0x24, 0x3a, 0x2b},
-    {0x24, 0x3b, 0x18},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x08},
-    {0x24, 0x3e, 0xcd},
-    {0x24, 0x3f, 0xaa},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 200 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf8},
-    {0x24, 0x42, 0x2c},
-    {0x24, 0x43, 0x87},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x49},
-    {0x24, 0x46, 0xb1},
-    {0x24, 0x47, 0x28},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xbe},
-    {0x24, 0x4a, 0x80},
-    {0x24, 0x4b, 0x36},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xc9},
-    {0x24, 0x4e, 0x2f},
-    {0x24, 0x4f, 0xb1},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x36},
-    {0x24, 0x52, 0x72},
-    {0x24, 0x53, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_80[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 80 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x88},
-    {0x24, 0x1a, 0xae},
-    {0x24, 0x1b, 0x29},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xee},
-    {0x24, 0x1e, 0xa3},
-    {0x24, 0x1f, 0xae},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x88},
-    {0x24, 0x22, 0xae},
-    {0x24, 0x23, 0x29},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf5},
-    {0x24, 0x26, 0xe7},
-    {0x24, 0x27, 0xb8},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0a},
-    {0x24, 0x2a, 0x0e},
-    {0x24, 0x2b, 0xd3},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 80 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x88},
-    {0x24, 0x2e, 0xae},
-    {0x24, 0x2f, 0x29},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xee},
-    {0x24, 0x32, 0xa3},
-    {0x24, 0x33, 0xae},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x88},
-    {0x24, 0x36, 0xae},
-    {0x24, 0x37, 0x29},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf5},
-    {0x24, 0x3a, 0xe7},
-    {0x24, 0x3b, 0xb8},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0a},
-    {0x24, 0x3e, 0x0e},
-    {0x24, 0x3f, 0xd3},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 200 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf8},
-    {0x24, 0x42, 0x2c},
-    {0x24, 0x43, 0x87},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x49},
-    {0x24, 0x46, 0xb1},
-    {0x24, 0x47, 0x28},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xbe},
-    {0x24, 0x4a, 0x80},
-    {0x24, 0x4b, 0x36},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xc9},
-    {0x24, 0x4e, 0x2f},
-    {0x24, 0x4f, 0xb1},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x36},
-    {0x24, 0x52, 0x72},
-    {0x24, 0x53, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_90[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 90 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x88},
-    {0x24, 0x1a, 0x16},
-    {0x24, 0x1b, 0x11},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xef},
-    {0x24, 0x1e, 0xd3},
-    {0x24, 0x1f, 0xdf},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x88},
-    {0x24, 0x22, 0x16},
-    {0x24, 0x23, 0x11},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf4},
-    {0x24, 0x26, 0xa4},
-    {0x24, 0x27, 0x3f},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0b},
-    {0x24, 0x2a, 0x4f},
-    {0x24, 0x2b, 0xca},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 90 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x88},
-    {0x24, 0x2e, 0x16},
-    {0x24, 0x2f, 0x11},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xef},
-    {0x24, 0x32, 0xd3},
-    {0x24, 0x33, 0xdf},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x88},
-    {0x24, 0x36, 0x16},
-    {0x24, 0x37, 0x11},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf4},
-    {0x24, 0x3a, 0xa4},
-    {0x24, 0x3b, 0x3f},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0b},
-    {0x24, 0x3e, 0x4f},
-    {0x24, 0x3f, 0xca},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 200 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf8},
-    {0x24, 0x42, 0x2c},
-    {0x24, 0x43, 0x87},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x49},
-    {0x24, 0x46, 0xb1},
-    {0x24, 0x47, 0x28},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xbe},
-    {0x24, 0x4a, 0x80},
-    {0x24, 0x4b, 0x36},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xc9},
-    {0x24, 0x4e, 0x2f},
-    {0x24, 0x4f, 0xb1},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x36},
-    {0x24, 0x52, 0x72},
-    {0x24, 0x53, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_100[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 100 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x87},
-    {0x24, 0x1a, 0x7d},
-    {0x24, 0x1b, 0xfe},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xf1},
-    {0x24, 0x1e, 0x04},
-    {0x24, 0x1f, 0x04},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x87},
-    {0x24, 0x22, 0x7d},
-    {0x24, 0x23, 0xfe},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf3},
-    {0x24, 0x26, 0x60},
-    {0x24, 0x27, 0xae},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0c},
-    {0x24, 0x2a, 0x90},
-    {0x24, 0x2b, 0x8e},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 100 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x87},
-    {0x24, 0x2e, 0x7d},
-    {0x24, 0x2f, 0xfe},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xf1},
-    {0x24, 0x32, 0x04},
-    {0x24, 0x33, 0x04},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x87},
-    {0x24, 0x36, 0x7d},
-    {0x24, 0x37, 0xfe},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf3},
-    {0x24, 0x3a, 0x60},
-    {0x24, 0x3b, 0xae},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0c},
-    {0x24, 0x3e, 0x90},
-    {0x24, 0x3f, 0x8e},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 200 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf8},
-    {0x24, 0x42, 0x2c},
-    {0x24, 0x43, 0x87},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x49},
-    {0x24, 0x46, 0xb1},
-    {0x24, 0x47, 0x28},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xbe},
-    {0x24, 0x4a, 0x80},
-    {0x24, 0x4b, 0x36},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xc9},
-    {0x24, 0x4e, 0x2f},
-    {0x24, 0x4f, 0xb1},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x36},
-    {0x24, 0x52, 0x72},
-    {0x24, 0x53, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_110[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 110 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x86},
-    {0x24, 0x1a, 0xe5},
-    {0x24, 0x1b, 0xf2},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xf2},
-    {0x24, 0x1e, 0x34},
-    {0x24, 0x1f, 0x1d},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x86},
-    {0x24, 0x22, 0xe5},
-    {0x24, 0x23, 0xf2},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf2},
-    {0x24, 0x26, 0x1d},
-    {0x24, 0x27, 0x04},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0d},
-    {0x24, 0x2a, 0xd1},
-    {0x24, 0x2b, 0x1f},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 110 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x86},
-    {0x24, 0x2e, 0xe5},
-    {0x24, 0x2f, 0xf2},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xf2},
-    {0x24, 0x32, 0x34},
-    {0x24, 0x33, 0x1d},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x86},
-    {0x24, 0x36, 0xe5},
-    {0x24, 0x37, 0xf2},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf2},
-    {0x24, 0x3a, 0x1d},
-    {0x24, 0x3b, 0x04},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0d},
-    {0x24, 0x3e, 0xd1},
-    {0x24, 0x3f, 0x1f},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 220 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf8},
-    {0x24, 0x42, 0x00},
-    {0x24, 0x43, 0xd4},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x4f},
-    {0x24, 0x46, 0xca},
-    {0x24, 0x47, 0xe2},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xb8},
-    {0x24, 0x4a, 0xa5},
-    {0x24, 0x4b, 0xbf},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xc3},
-    {0x24, 0x4e, 0xbe},
-    {0x24, 0x4f, 0xbd},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x3b},
-    {0x24, 0x52, 0xcf},
-    {0x24, 0x53, 0xce},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_120[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 120 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x86},
-    {0x24, 0x1a, 0x4d},
-    {0x24, 0x1b, 0xeb},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xf3},
-    {0x24, 0x1e, 0x64},
-    {0x24, 0x1f, 0x29},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x86},
-    {0x24, 0x22, 0x4d},
-    {0x24, 0x23, 0xeb},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xf0},
-    {0x24, 0x26, 0xd9},
-    {0x24, 0x27, 0x42},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x0f},
-    {0x24, 0x2a, 0x11},
-    {0x24, 0x2b, 0x7e},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 120 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x86},
-    {0x24, 0x2e, 0x4d},
-    {0x24, 0x2f, 0xeb},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xf3},
-    {0x24, 0x32, 0x64},
-    {0x24, 0x33, 0x29},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x86},
-    {0x24, 0x36, 0x4d},
-    {0x24, 0x37, 0xeb},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xf0},
-    {0x24, 0x3a, 0xd9},
-    {0x24, 0x3b, 0x42},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x0f},
-    {0x24, 0x3e, 0x11},
-    {0x24, 0x3f, 0x7e},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 240 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf7},
-    {0x24, 0x42, 0xd5},
-    {0x24, 0x43, 0x31},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x55},
-    {0x24, 0x46, 0xe2},
-    {0x24, 0x47, 0x6d},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xb2},
-    {0x24, 0x4a, 0xcf},
-    {0x24, 0x4b, 0x3a},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xbe},
-    {0x24, 0x4e, 0x4f},
-    {0x24, 0x4f, 0xa2},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x41},
-    {0x24, 0x52, 0x29},
-    {0x24, 0x53, 0x86},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_130[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 130 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x85},
-    {0x24, 0x1a, 0xb5},
-    {0x24, 0x1b, 0xeb},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xf4},
-    {0x24, 0x1e, 0x94},
-    {0x24, 0x1f, 0x29},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x85},
-    {0x24, 0x22, 0xb5},
-    {0x24, 0x23, 0xeb},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xef},
-    {0x24, 0x26, 0x95},
-    {0x24, 0x27, 0x67},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x10},
-    {0x24, 0x2a, 0x51},
-    {0x24, 0x2b, 0xaa},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 130 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x85},
-    {0x24, 0x2e, 0xb5},
-    {0x24, 0x2f, 0xeb},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xf4},
-    {0x24, 0x32, 0x94},
-    {0x24, 0x33, 0x29},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x85},
-    {0x24, 0x36, 0xb5},
-    {0x24, 0x37, 0xeb},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xef},
-    {0x24, 0x3a, 0x95},
-    {0x24, 0x3b, 0x67},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x10},
-    {0x24, 0x3e, 0x51},
-    {0x24, 0x3f, 0xaa},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 260 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf7},
-    {0x24, 0x42, 0xa9},
-    {0x24, 0x43, 0x9d},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x5b},
-    {0x24, 0x46, 0xf7},
-    {0x24, 0x47, 0xca},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xac},
-    {0x24, 0x4a, 0xfc},
-    {0x24, 0x4b, 0xa4},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xb8},
-    {0x24, 0x4e, 0xe2},
-    {0x24, 0x4f, 0x5e},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x46},
-    {0x24, 0x52, 0x7f},
-    {0x24, 0x53, 0x96},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_140[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 140 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x85},
-    {0x24, 0x1a, 0x1d},
-    {0x24, 0x1b, 0xf1},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xf5},
-    {0x24, 0x1e, 0xc4},
-    {0x24, 0x1f, 0x1d},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x85},
-    {0x24, 0x22, 0x1d},
-    {0x24, 0x23, 0xf1},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xee},
-    {0x24, 0x26, 0x51},
-    {0x24, 0x27, 0x74},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x11},
-    {0x24, 0x2a, 0x91},
-    {0x24, 0x2b, 0xa4},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 140 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x85},
-    {0x24, 0x2e, 0x1d},
-    {0x24, 0x2f, 0xf1},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xf5},
-    {0x24, 0x32, 0xc4},
-    {0x24, 0x33, 0x1d},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x85},
-    {0x24, 0x36, 0x1d},
-    {0x24, 0x37, 0xf1},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xee},
-    {0x24, 0x3a, 0x51},
-    {0x24, 0x3b, 0x74},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x11},
-    {0x24, 0x3e, 0x91},
-    {0x24, 0x3f, 0xa4},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 280 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf7},
-    {0x24, 0x42, 0x7e},
-    {0x24, 0x43, 0x18},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x62},
-    {0x24, 0x46, 0x0a},
-    {0x24, 0x47, 0xfb},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xa7},
-    {0x24, 0x4a, 0x2d},
-    {0x24, 0x4b, 0xfa},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xb3},
-    {0x24, 0x4e, 0x76},
-    {0x24, 0x4f, 0xf2},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x4b},
-    {0x24, 0x52, 0xd2},
-    {0x24, 0x53, 0x01},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_left_hf_150[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x24, 0x18, 0x07}, //  Biquad -  BQ1 Left   -     Filter: High Pass-Chebyshev  Frequency: 150 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x19, 0x84},
-    {0x24, 0x1a, 0x85},
-    {0x24, 0x1b, 0xfd},
-    {0x24, 0x1c, 0xf0},
-    {0x24, 0x1d, 0xf6},
-    {0x24, 0x1e, 0xf4},
-    {0x24, 0x1f, 0x05},
-    {0x24, 0x20, 0x07},
-    {0x24, 0x21, 0x84},
-    {0x24, 0x22, 0x85},
-    {0x24, 0x23, 0xfd},
-    {0x24, 0x24, 0x0f},
-    {0x24, 0x25, 0xed},
-    {0x24, 0x26, 0x0d},
-    {0x24, 0x27, 0x68},
-    {0x24, 0x28, 0xf8},
-    {0x24, 0x29, 0x12},
-    {0x24, 0x2a, 0xd1},
-    {0x24, 0x2b, 0x6b},
-    {0x24, 0x2c, 0x07}, //  Biquad -  BQ2 Left   -     Filter: High Pass-Chebyshev  Frequency: 150 Hz  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x2d, 0x84},
-    {0x24, 0x2e, 0x85},
-    {0x24, 0x2f, 0xfd},
-    {0x24, 0x30, 0xf0},
-    {0x24, 0x31, 0xf6},
-    {0x24, 0x32, 0xf4},
-    {0x24, 0x33, 0x05},
-    {0x24, 0x34, 0x07},
-    {0x24, 0x35, 0x84},
-    {0x24, 0x36, 0x85},
-    {0x24, 0x37, 0xfd},
-    {0x24, 0x38, 0x0f},
-    {0x24, 0x39, 0xed},
-    {0x24, 0x3a, 0x0d},
-    {0x24, 0x3b, 0x68},
-    {0x24, 0x3c, 0xf8},
-    {0x24, 0x3d, 0x12},
-    {0x24, 0x3e, 0xd1},
-    {0x24, 0x3f, 0x6b},
-    {0x24, 0x40, 0x08}, //  Biquad -  BQ3 Left   -     Filter: High Shelf  Frequency: 300 Hz  Gain: 1dB  QVal: 0.5  Bandwidth: 1000 Hz
-    {0x24, 0x41, 0xf7},
-    {0x24, 0x42, 0x52},
-    {0x24, 0x43, 0xa3},
-    {0x24, 0x44, 0xee},
-    {0x24, 0x45, 0x68},
-    {0x24, 0x46, 0x1c},
-    {0x24, 0x47, 0x01},
-    {0x24, 0x48, 0x08},
-    {0x24, 0x49, 0xa1},
-    {0x24, 0x4a, 0x63},
-    {0x24, 0x4b, 0x38},
-    {0x24, 0x4c, 0x0f},
-    {0x24, 0x4d, 0xae},
-    {0x24, 0x4e, 0x0d},
-    {0x24, 0x4f, 0x5a},
-    {0x24, 0x50, 0xf8},
-    {0x24, 0x51, 0x51},
-    {0x24, 0x52, 0x20},
-    {0x24, 0x53, 0xca},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_flat[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x08}, //		Biquad	-		BQ1	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x00},
-    {0x26, 0x57, 0x00},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x00},
-    {0x26, 0x5b, 0x00},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x00},
-    {0x26, 0x5f, 0x00},
-    {0x26, 0x60, 0x00},
-    {0x26, 0x61, 0x00},
-    {0x26, 0x62, 0x00},
-    {0x26, 0x63, 0x00},
-    {0x26, 0x64, 0x00},
-    {0x26, 0x65, 0x00},
-    {0x26, 0x66, 0x00},
-    {0x26, 0x67, 0x00},
-    {0x26, 0x68, 0x08}, //		Biquad	-		BQ2	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x00},
-    {0x26, 0x6b, 0x00},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x00},
-    {0x26, 0x6f, 0x00},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x00},
-    {0x26, 0x73, 0x00},
-    {0x26, 0x74, 0x00},
-    {0x26, 0x75, 0x00},
-    {0x26, 0x76, 0x00},
-    {0x26, 0x77, 0x00},
-    {0x26, 0x78, 0x00},
-    {0x26, 0x79, 0x00},
-    {0x26, 0x7a, 0x00},
-    {0x26, 0x7b, 0x00},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_60[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	60	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x02},
-    {0x26, 0x57, 0xe3},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x05},
-    {0x26, 0x5b, 0xc5},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x02},
-    {0x26, 0x5f, 0xe3},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf4},
-    {0x26, 0x62, 0x84},
-    {0x26, 0x63, 0xcd},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0b},
-    {0x26, 0x66, 0x6e},
-    {0x26, 0x67, 0xfa},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	60	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x02},
-    {0x26, 0x6b, 0xe3},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x05},
-    {0x26, 0x6f, 0xc5},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x02},
-    {0x26, 0x73, 0xe3},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf4},
-    {0x26, 0x76, 0x84},
-    {0x26, 0x77, 0xcd},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0b},
-    {0x26, 0x7a, 0x6e},
-    {0x26, 0x7b, 0xfa},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_70[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	70	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x03},
-    {0x26, 0x57, 0xed},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x07},
-    {0x26, 0x5b, 0xda},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x03},
-    {0x26, 0x5f, 0xed},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf2},
-    {0x26, 0x62, 0x9a},
-    {0x26, 0x63, 0x28},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0d},
-    {0x26, 0x66, 0x55},
-    {0x26, 0x67, 0x36},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	70	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x03},
-    {0x26, 0x6b, 0xed},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x07},
-    {0x26, 0x6f, 0xda},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x03},
-    {0x26, 0x73, 0xed},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf2},
-    {0x26, 0x76, 0x9a},
-    {0x26, 0x77, 0x28},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0d},
-    {0x26, 0x7a, 0x55},
-    {0x26, 0x7b, 0x36},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_80[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	80	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x05},
-    {0x26, 0x57, 0x20},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x0a},
-    {0x26, 0x5b, 0x40},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x05},
-    {0x26, 0x5f, 0x20},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf0},
-    {0x26, 0x62, 0xaf},
-    {0x26, 0x63, 0x4c},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0f},
-    {0x26, 0x66, 0x3a},
-    {0x26, 0x67, 0xfe},
-    {0x26, 0x68, 0x00}, //	Biquad	-		BQ2	Left			-					Filter:	Low	Pass-Chebyshev		Frequency:	80	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x05},
-    {0x26, 0x6b, 0x20},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x0a},
-    {0x26, 0x6f, 0x40},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x05},
-    {0x26, 0x73, 0x20},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf0},
-    {0x26, 0x76, 0xaf},
-    {0x26, 0x77, 0x4c},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0f},
-    {0x26, 0x7a, 0x3a},
-    {0x26, 0x7b, 0xfe},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_90[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	90	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x06},
-    {0x26, 0x57, 0x7c},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x0c},
-    {0x26, 0x5b, 0xf7},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x06},
-    {0x26, 0x5f, 0x7c},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xee},
-    {0x26, 0x62, 0xc4},
-    {0x26, 0x63, 0x37},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x11},
-    {0x26, 0x66, 0x20},
-    {0x26, 0x67, 0x52},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	90	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x06},
-    {0x26, 0x6b, 0x7c},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x0c},
-    {0x26, 0x6f, 0xf7},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x06},
-    {0x26, 0x73, 0x7c},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xee},
-    {0x26, 0x76, 0xc4},
-    {0x26, 0x77, 0x37},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x11},
-    {0x26, 0x7a, 0x20},
-    {0x26, 0x7b, 0x52},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_100[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	100	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x08},
-    {0x26, 0x57, 0x00},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x10},
-    {0x26, 0x5b, 0x00},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x08},
-    {0x26, 0x5f, 0x00},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xec},
-    {0x26, 0x62, 0xd8},
-    {0x26, 0x63, 0xea},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x13},
-    {0x26, 0x66, 0x05},
-    {0x26, 0x67, 0x31},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	100	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x08},
-    {0x26, 0x6b, 0x00},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x10},
-    {0x26, 0x6f, 0x00},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x08},
-    {0x26, 0x73, 0x00},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xec},
-    {0x26, 0x76, 0xd8},
-    {0x26, 0x77, 0xea},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x13},
-    {0x26, 0x7a, 0x05},
-    {0x26, 0x7b, 0x31},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_110[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Left			-					Filter:	Low	Pass-Chebyshev		Frequency:	110	Hz		QVal:	0.71		Bandwidth:	1000
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x09},
-    {0x26, 0x57, 0xad},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x13},
-    {0x26, 0x5b, 0x59},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x09},
-    {0x26, 0x5f, 0xad},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xea},
-    {0x26, 0x62, 0xed},
-    {0x26, 0x63, 0x66},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x14},
-    {0x26, 0x66, 0xe9},
-    {0x26, 0x67, 0x9c},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Left			-					Filter:	Low	Pass-Chebyshev		Frequency:	110	Hz		QVal:	0.71		Bandwidth:	1000
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x09},
-    {0x26, 0x6b, 0xad},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x13},
-    {0x26, 0x6f, 0x59},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x09},
-    {0x26, 0x73, 0xad},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xea},
-    {0x26, 0x76, 0xed},
-    {0x26, 0x77, 0x66},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x14},
-    {0x26, 0x7a, 0xe9},
-    {0x26, 0x7b, 0x9c},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_120[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //	Biquad	-		BQ1	Left			-					Filter:	Low	Pass-Chebyshev		Frequency:	120	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x0b},
-    {0x26, 0x57, 0x82},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x17},
-    {0x26, 0x5b, 0x04},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x0b},
-    {0x26, 0x5f, 0x82},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xe9},
-    {0x26, 0x62, 0x01},
-    {0x26, 0x63, 0xaa},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x16},
-    {0x26, 0x66, 0xcd},
-    {0x26, 0x67, 0x93},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	120	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x0b},
-    {0x26, 0x6b, 0x82},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x17},
-    {0x26, 0x6f, 0x04},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x0b},
-    {0x26, 0x73, 0x82},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xe9},
-    {0x26, 0x76, 0x01},
-    {0x26, 0x77, 0xaa},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x16},
-    {0x26, 0x7a, 0xcd},
-    {0x26, 0x7b, 0x93},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_130[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //			Biquad	-		BQ1	Left			-					Filter:	Low	Pass-Chebyshev		Frequency:	130	Hz		QVal:	0.71		Bandwidth:	1000
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x0d},
-    {0x26, 0x57, 0x80},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x1b},
-    {0x26, 0x5b, 0x00},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x0d},
-    {0x26, 0x5f, 0x80},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xe7},
-    {0x26, 0x62, 0x15},
-    {0x26, 0x63, 0xb6},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x18},
-    {0x26, 0x66, 0xb1},
-    {0x26, 0x67, 0x16},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	130	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x0d},
-    {0x26, 0x6b, 0x80},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x1b},
-    {0x26, 0x6f, 0x00},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x0d},
-    {0x26, 0x73, 0x80},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xe7},
-    {0x26, 0x76, 0x15},
-    {0x26, 0x77, 0xb6},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x18},
-    {0x26, 0x7a, 0xb1},
-    {0x26, 0x7b, 0x16},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_140[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	140	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x0f},
-    {0x26, 0x57, 0xa6},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x1f},
-    {0x26, 0x5b, 0x4d},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x0f},
-    {0x26, 0x5f, 0xa6},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xe5},
-    {0x26, 0x62, 0x29},
-    {0x26, 0x63, 0x8b},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x1a},
-    {0x26, 0x66, 0x94},
-    {0x26, 0x67, 0x26},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	140	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x0f},
-    {0x26, 0x6b, 0xa6},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x1f},
-    {0x26, 0x6f, 0x4d},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x0f},
-    {0x26, 0x73, 0xa6},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xe5},
-    {0x26, 0x76, 0x29},
-    {0x26, 0x77, 0x8b},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x1a},
-    {0x26, 0x7a, 0x94},
-    {0x26, 0x7b, 0x26},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_lf_150[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x00}, //		Biquad	-		BQ1	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	150	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x00},
-    {0x26, 0x56, 0x11},
-    {0x26, 0x57, 0xf5},
-    {0x26, 0x58, 0x00},
-    {0x26, 0x59, 0x00},
-    {0x26, 0x5a, 0x23},
-    {0x26, 0x5b, 0xea},
-    {0x26, 0x5c, 0x00},
-    {0x26, 0x5d, 0x00},
-    {0x26, 0x5e, 0x11},
-    {0x26, 0x5f, 0xf5},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xe3},
-    {0x26, 0x62, 0x3d},
-    {0x26, 0x63, 0x2a},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x1c},
-    {0x26, 0x66, 0x76},
-    {0x26, 0x67, 0xc1},
-    {0x26, 0x68, 0x00}, //		Biquad	-		BQ2	Right			-					Filter:	Low	Pass-Chebyshev		Frequency:	150	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x00},
-    {0x26, 0x6a, 0x11},
-    {0x26, 0x6b, 0xf5},
-    {0x26, 0x6c, 0x00},
-    {0x26, 0x6d, 0x00},
-    {0x26, 0x6e, 0x23},
-    {0x26, 0x6f, 0xea},
-    {0x26, 0x70, 0x00},
-    {0x26, 0x71, 0x00},
-    {0x26, 0x72, 0x11},
-    {0x26, 0x73, 0xf5},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xe3},
-    {0x26, 0x76, 0x3d},
-    {0x26, 0x77, 0x2a},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x1c},
-    {0x26, 0x7a, 0x76},
-    {0x26, 0x7b, 0xc1},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	All	Pass		Frequency:	1000	Hz		QVal:	0.71		Bandwidth:	1000	Hz
-    {0x26, 0x7d, 0x00},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0x00},
-    {0x27, 0x08, 0x00},
-    {0x27, 0x09, 0x00},
-    {0x27, 0x0a, 0x00},
-    {0x27, 0x0b, 0x00},
-    {0x27, 0x0c, 0x00},
-    {0x27, 0x0d, 0x00},
-    {0x27, 0x0e, 0x00},
-    {0x27, 0x0f, 0x00},
-    {0x27, 0x10, 0x00},
-    {0x27, 0x11, 0x00},
-    {0x27, 0x12, 0x00},
-    {0x27, 0x13, 0x00},
-    {0x27, 0x14, 0x00},
-    {0x27, 0x15, 0x00},
-    {0x27, 0x16, 0x00},
-    {0x27, 0x17, 0x00},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_60[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	60	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x89},
-    {0x26, 0x56, 0xde},
-    {0x26, 0x57, 0x6d},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xec},
-    {0x26, 0x5a, 0x43},
-    {0x26, 0x5b, 0x27},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x89},
-    {0x26, 0x5e, 0xde},
-    {0x26, 0x5f, 0x6d},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf8},
-    {0x26, 0x62, 0x6e},
-    {0x26, 0x63, 0x5f},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x07},
-    {0x26, 0x66, 0x8c},
-    {0x26, 0x67, 0x4f},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	60	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x89},
-    {0x26, 0x6a, 0xde},
-    {0x26, 0x6b, 0x6d},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xec},
-    {0x26, 0x6e, 0x43},
-    {0x26, 0x6f, 0x27},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x89},
-    {0x26, 0x72, 0xde},
-    {0x26, 0x73, 0x6d},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf8},
-    {0x26, 0x76, 0x6e},
-    {0x26, 0x77, 0x5f},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x07},
-    {0x26, 0x7a, 0x8c},
-    {0x26, 0x7b, 0x4f},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	200	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf8},
-    {0x26, 0x7e, 0x2c},
-    {0x26, 0x7f, 0x87},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x49},
-    {0x27, 0x0a, 0xb1},
-    {0x27, 0x0b, 0x28},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xbe},
-    {0x27, 0x0e, 0x80},
-    {0x27, 0x0f, 0x36},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xc9},
-    {0x27, 0x12, 0x2f},
-    {0x27, 0x13, 0xb1},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x36},
-    {0x27, 0x16, 0x72},
-    {0x27, 0x17, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_70[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Left			-					Filter:	High	Pass-Chebyshev		Frequency:	70	Hz		QVal:	0.5		Bandwidth:	1000
-    {0x26, 0x55, 0x89},
-    {0x26, 0x56, 0x46},
-    {0x26, 0x57, 0x48},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xed},
-    {0x26, 0x5a, 0x73},
-    {0x26, 0x5b, 0x70},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x89},
-    {0x26, 0x5e, 0x46},
-    {0x26, 0x5f, 0x48},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf7},
-    {0x26, 0x62, 0x2b},
-    {0x26, 0x63, 0x18},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x08},
-    {0x26, 0x66, 0xcd},
-    {0x26, 0x67, 0xaa},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Left			-					Filter:	High	Pass-Chebyshev		Frequency:	70	Hz		QVal:	0.5		Bandwidth:	1000
-    {0x26, 0x69, 0x89},
-    {0x26, 0x6a, 0x46},
-    {0x26, 0x6b, 0x48},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xed},
-    {0x26, 0x6e, 0x73},
-    {0x26, 0x6f, 0x70},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x89},
-    {0x26, 0x72, 0x46},
-    {0x26, 0x73, 0x48},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf7},
-    {0x26, 0x76, 0x2b},
-    {0x26, 0x77, 0x18},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x08},
-    {0x26, 0x7a, 0xcd},
-    {0x26, 0x7b, 0xaa},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Left			-					Filter:	High	Shelf		Frequency:	200	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf8},
-    {0x26, 0x7e, 0x2c},
-    {0x26, 0x7f, 0x87},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x49},
-    {0x27, 0x0a, 0xb1},
-    {0x27, 0x0b, 0x28},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xbe},
-    {0x27, 0x0e, 0x80},
-    {0x27, 0x0f, 0x36},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xc9},
-    {0x27, 0x12, 0x2f},
-    {0x27, 0x13, 0xb1},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x36},
-    {0x27, 0x16, 0x72},
-    {0x27, 0x17, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_80[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	80	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x88},
-    {0x26, 0x56, 0xae},
-    {0x26, 0x57, 0x29},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xee},
-    {0x26, 0x5a, 0xa3},
-    {0x26, 0x5b, 0xae},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x88},
-    {0x26, 0x5e, 0xae},
-    {0x26, 0x5f, 0x29},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf5},
-    {0x26, 0x62, 0xe7},
-    {0x26, 0x63, 0xb8},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0a},
-    {0x26, 0x66, 0x0e},
-    {0x26, 0x67, 0xd3},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	80	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x88},
-    {0x26, 0x6a, 0xae},
-    {0x26, 0x6b, 0x29},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xee},
-    {0x26, 0x6e, 0xa3},
-    {0x26, 0x6f, 0xae},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x88},
-    {0x26, 0x72, 0xae},
-    {0x26, 0x73, 0x29},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf5},
-    {0x26, 0x76, 0xe7},
-    {0x26, 0x77, 0xb8},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0a},
-    {0x26, 0x7a, 0x0e},
-    {0x26, 0x7b, 0xd3},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	200	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf8},
-    {0x26, 0x7e, 0x2c},
-    {0x26, 0x7f, 0x87},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x49},
-    {0x27, 0x0a, 0xb1},
-    {0x27, 0x0b, 0x28},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xbe},
-    {0x27, 0x0e, 0x80},
-    {0x27, 0x0f, 0x36},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xc9},
-    {0x27, 0x12, 0x2f},
-    {0x27, 0x13, 0xb1},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x36},
-    {0x27, 0x16, 0x72},
-    {0x27, 0x17, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_90[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	90	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x88},
-    {0x26, 0x56, 0x16},
-    {0x26, 0x57, 0x11},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xef},
-    {0x26, 0x5a, 0xd3},
-    {0x26, 0x5b, 0xdf},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x88},
-    {0x26, 0x5e, 0x16},
-    {0x26, 0x5f, 0x11},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf4},
-    {0x26, 0x62, 0xa4},
-    {0x26, 0x63, 0x3f},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0b},
-    {0x26, 0x66, 0x4f},
-    {0x26, 0x67, 0xca},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	90	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x88},
-    {0x26, 0x6a, 0x16},
-    {0x26, 0x6b, 0x11},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xef},
-    {0x26, 0x6e, 0xd3},
-    {0x26, 0x6f, 0xdf},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x88},
-    {0x26, 0x72, 0x16},
-    {0x26, 0x73, 0x11},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf4},
-    {0x26, 0x76, 0xa4},
-    {0x26, 0x77, 0x3f},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0b},
-    {0x26, 0x7a, 0x4f},
-    {0x26, 0x7b, 0xca},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	200	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf8},
-    {0x26, 0x7e, 0x2c},
-    {0x26, 0x7f, 0x87},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x49},
-    {0x27, 0x0a, 0xb1},
-    {0x27, 0x0b, 0x28},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xbe},
-    {0x27, 0x0e, 0x80},
-    {0x27, 0x0f, 0x36},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xc9},
-    {0x27, 0x12, 0x2f},
-    {0x27, 0x13, 0xb1},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x36},
-    {0x27, 0x16, 0x72},
-    {0x27, 0x17, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_100[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	100	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x87},
-    {0x26, 0x56, 0x7d},
-    {0x26, 0x57, 0xfe},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xf1},
-    {0x26, 0x5a, 0x04},
-    {0x26, 0x5b, 0x04},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x87},
-    {0x26, 0x5e, 0x7d},
-    {0x26, 0x5f, 0xfe},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf3},
-    {0x26, 0x62, 0x60},
-    {0x26, 0x63, 0xae},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0c},
-    {0x26, 0x66, 0x90},
-    {0x26, 0x67, 0x8e},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	100	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x87},
-    {0x26, 0x6a, 0x7d},
-    {0x26, 0x6b, 0xfe},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xf1},
-    {0x26, 0x6e, 0x04},
-    {0x26, 0x6f, 0x04},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x87},
-    {0x26, 0x72, 0x7d},
-    {0x26, 0x73, 0xfe},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf3},
-    {0x26, 0x76, 0x60},
-    {0x26, 0x77, 0xae},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0c},
-    {0x26, 0x7a, 0x90},
-    {0x26, 0x7b, 0x8e},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	200	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf8},
-    {0x26, 0x7e, 0x2c},
-    {0x26, 0x7f, 0x87},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x49},
-    {0x27, 0x0a, 0xb1},
-    {0x27, 0x0b, 0x28},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xbe},
-    {0x27, 0x0e, 0x80},
-    {0x27, 0x0f, 0x36},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xc9},
-    {0x27, 0x12, 0x2f},
-    {0x27, 0x13, 0xb1},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x36},
-    {0x27, 0x16, 0x72},
-    {0x27, 0x17, 0x6a},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_110[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	110	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x86},
-    {0x26, 0x56, 0xe5},
-    {0x26, 0x57, 0xf2},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xf2},
-    {0x26, 0x5a, 0x34},
-    {0x26, 0x5b, 0x1d},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x86},
-    {0x26, 0x5e, 0xe5},
-    {0x26, 0x5f, 0xf2},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf2},
-    {0x26, 0x62, 0x1d},
-    {0x26, 0x63, 0x04},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0d},
-    {0x26, 0x66, 0xd1},
-    {0x26, 0x67, 0x1f},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	110	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x86},
-    {0x26, 0x6a, 0xe5},
-    {0x26, 0x6b, 0xf2},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xf2},
-    {0x26, 0x6e, 0x34},
-    {0x26, 0x6f, 0x1d},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x86},
-    {0x26, 0x72, 0xe5},
-    {0x26, 0x73, 0xf2},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf2},
-    {0x26, 0x76, 0x1d},
-    {0x26, 0x77, 0x04},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0d},
-    {0x26, 0x7a, 0xd1},
-    {0x26, 0x7b, 0x1f},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	220	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf8},
-    {0x26, 0x7e, 0x00},
-    {0x26, 0x7f, 0xd4},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x4f},
-    {0x27, 0x0a, 0xca},
-    {0x27, 0x0b, 0xe2},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xb8},
-    {0x27, 0x0e, 0xa5},
-    {0x27, 0x0f, 0xbf},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xc3},
-    {0x27, 0x12, 0xbe},
-    {0x27, 0x13, 0xbd},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x3b},
-    {0x27, 0x16, 0xcf},
-    {0x27, 0x17, 0xce},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_120[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	120	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x86},
-    {0x26, 0x56, 0x4d},
-    {0x26, 0x57, 0xeb},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xf3},
-    {0x26, 0x5a, 0x64},
-    {0x26, 0x5b, 0x29},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x86},
-    {0x26, 0x5e, 0x4d},
-    {0x26, 0x5f, 0xeb},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xf0},
-    {0x26, 0x62, 0xd9},
-    {0x26, 0x63, 0x42},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x0f},
-    {0x26, 0x66, 0x11},
-    {0x26, 0x67, 0x7e},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	120	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x86},
-    {0x26, 0x6a, 0x4d},
-    {0x26, 0x6b, 0xeb},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xf3},
-    {0x26, 0x6e, 0x64},
-    {0x26, 0x6f, 0x29},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x86},
-    {0x26, 0x72, 0x4d},
-    {0x26, 0x73, 0xeb},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xf0},
-    {0x26, 0x76, 0xd9},
-    {0x26, 0x77, 0x42},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x0f},
-    {0x26, 0x7a, 0x11},
-    {0x26, 0x7b, 0x7e},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	240	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf7},
-    {0x26, 0x7e, 0xd5},
-    {0x26, 0x7f, 0x31},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x55},
-    {0x27, 0x0a, 0xe2},
-    {0x27, 0x0b, 0x6d},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xb2},
-    {0x27, 0x0e, 0xcf},
-    {0x27, 0x0f, 0x3a},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xbe},
-    {0x27, 0x12, 0x4f},
-    {0x27, 0x13, 0xa2},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x41},
-    {0x27, 0x16, 0x29},
-    {0x27, 0x17, 0x86},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_130[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	130	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x85},
-    {0x26, 0x56, 0xb5},
-    {0x26, 0x57, 0xeb},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xf4},
-    {0x26, 0x5a, 0x94},
-    {0x26, 0x5b, 0x29},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x85},
-    {0x26, 0x5e, 0xb5},
-    {0x26, 0x5f, 0xeb},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xef},
-    {0x26, 0x62, 0x95},
-    {0x26, 0x63, 0x67},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x10},
-    {0x26, 0x66, 0x51},
-    {0x26, 0x67, 0xaa},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	130	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x85},
-    {0x26, 0x6a, 0xb5},
-    {0x26, 0x6b, 0xeb},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xf4},
-    {0x26, 0x6e, 0x94},
-    {0x26, 0x6f, 0x29},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x85},
-    {0x26, 0x72, 0xb5},
-    {0x26, 0x73, 0xeb},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xef},
-    {0x26, 0x76, 0x95},
-    {0x26, 0x77, 0x67},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x10},
-    {0x26, 0x7a, 0x51},
-    {0x26, 0x7b, 0xaa},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	260	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf7},
-    {0x26, 0x7e, 0xa9},
-    {0x26, 0x7f, 0x9d},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x5b},
-    {0x27, 0x0a, 0xf7},
-    {0x27, 0x0b, 0xca},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xac},
-    {0x27, 0x0e, 0xfc},
-    {0x27, 0x0f, 0xa4},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xb8},
-    {0x27, 0x12, 0xe2},
-    {0x27, 0x13, 0x5e},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x46},
-    {0x27, 0x16, 0x7f},
-    {0x27, 0x17, 0x96},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_140[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	140	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x85},
-    {0x26, 0x56, 0x1d},
-    {0x26, 0x57, 0xf1},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xf5},
-    {0x26, 0x5a, 0xc4},
-    {0x26, 0x5b, 0x1d},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x85},
-    {0x26, 0x5e, 0x1d},
-    {0x26, 0x5f, 0xf1},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xee},
-    {0x26, 0x62, 0x51},
-    {0x26, 0x63, 0x74},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x11},
-    {0x26, 0x66, 0x91},
-    {0x26, 0x67, 0xa4},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	140	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x85},
-    {0x26, 0x6a, 0x1d},
-    {0x26, 0x6b, 0xf1},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xf5},
-    {0x26, 0x6e, 0xc4},
-    {0x26, 0x6f, 0x1d},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x85},
-    {0x26, 0x72, 0x1d},
-    {0x26, 0x73, 0xf1},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xee},
-    {0x26, 0x76, 0x51},
-    {0x26, 0x77, 0x74},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x11},
-    {0x26, 0x7a, 0x91},
-    {0x26, 0x7b, 0xa4},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	280	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf7},
-    {0x26, 0x7e, 0x7e},
-    {0x26, 0x7f, 0x18},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x62},
-    {0x27, 0x0a, 0x0a},
-    {0x27, 0x0b, 0xfb},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xa7},
-    {0x27, 0x0e, 0x2d},
-    {0x27, 0x0f, 0xfa},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xb3},
-    {0x27, 0x12, 0x76},
-    {0x27, 0x13, 0xf2},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x4b},
-    {0x27, 0x16, 0xd2},
-    {0x27, 0x17, 0x01},
-};
-
-static const reg_sequence_eq tas5805m_eq_registers_right_hf_150[TAS5805M_EQ_PROFILE_REG_PER_STEP] = {
-    {0x26, 0x54, 0x07}, //		Biquad	-		BQ1	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	150	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x55, 0x84},
-    {0x26, 0x56, 0x85},
-    {0x26, 0x57, 0xfd},
-    {0x26, 0x58, 0xf0},
-    {0x26, 0x59, 0xf6},
-    {0x26, 0x5a, 0xf4},
-    {0x26, 0x5b, 0x05},
-    {0x26, 0x5c, 0x07},
-    {0x26, 0x5d, 0x84},
-    {0x26, 0x5e, 0x85},
-    {0x26, 0x5f, 0xfd},
-    {0x26, 0x60, 0x0f},
-    {0x26, 0x61, 0xed},
-    {0x26, 0x62, 0x0d},
-    {0x26, 0x63, 0x68},
-    {0x26, 0x64, 0xf8},
-    {0x26, 0x65, 0x12},
-    {0x26, 0x66, 0xd1},
-    {0x26, 0x67, 0x6b},
-    {0x26, 0x68, 0x07}, //		Biquad	-		BQ2	Right			-					Filter:	High	Pass-Chebyshev		Frequency:	150	Hz		QVal:	0.5		Bandwidth:	1000	Hz
-    {0x26, 0x69, 0x84},
-    {0x26, 0x6a, 0x85},
-    {0x26, 0x6b, 0xfd},
-    {0x26, 0x6c, 0xf0},
-    {0x26, 0x6d, 0xf6},
-    {0x26, 0x6e, 0xf4},
-    {0x26, 0x6f, 0x05},
-    {0x26, 0x70, 0x07},
-    {0x26, 0x71, 0x84},
-    {0x26, 0x72, 0x85},
-    {0x26, 0x73, 0xfd},
-    {0x26, 0x74, 0x0f},
-    {0x26, 0x75, 0xed},
-    {0x26, 0x76, 0x0d},
-    {0x26, 0x77, 0x68},
-    {0x26, 0x78, 0xf8},
-    {0x26, 0x79, 0x12},
-    {0x26, 0x7a, 0xd1},
-    {0x26, 0x7b, 0x6b},
-    {0x26, 0x7c, 0x08}, //		Biquad	-		BQ3	Right			-					Filter:	High	Shelf		Frequency:	300	Hz		Gain:	1dB		QVal:	0.5
-    {0x26, 0x7d, 0xf7},
-    {0x26, 0x7e, 0x52},
-    {0x26, 0x7f, 0xa3},
-    {0x27, 0x08, 0xee},
-    {0x27, 0x09, 0x68},
-    {0x27, 0x0a, 0x1c},
-    {0x27, 0x0b, 0x01},
-    {0x27, 0x0c, 0x08},
-    {0x27, 0x0d, 0xa1},
-    {0x27, 0x0e, 0x63},
-    {0x27, 0x0f, 0x38},
-    {0x27, 0x10, 0x0f},
-    {0x27, 0x11, 0xae},
-    {0x27, 0x12, 0x0d},
-    {0x27, 0x13, 0x5a},
-    {0x27, 0x14, 0xf8},
-    {0x27, 0x15, 0x51},
-    {0x27, 0x16, 0x20},
-    {0x27, 0x17, 0xca},
-};
-
-/* Crossover frequency coefficient lookup (maps crossover_freq index to low-pass filter coefficients)
- * Index 0: OFF (flat/bypass), Index 1-10: 60Hz-150Hz low-pass filters for subwoofer
- */
-static const reg_sequence_eq *tas5805m_crossover_lf_registers[] = {
-    tas5805m_eq_registers_left_flat,    /* 0: OFF */
-    tas5805m_eq_registers_left_lf_60,   /* 1: 60 Hz */
-    tas5805m_eq_registers_left_lf_70,   /* 2: 70 Hz */
-    tas5805m_eq_registers_left_lf_80,   /* 3: 80 Hz */
-    tas5805m_eq_registers_left_lf_90,   /* 4: 90 Hz */
-    tas5805m_eq_registers_left_lf_100,  /* 5: 100 Hz */
-    tas5805m_eq_registers_left_lf_110,  /* 6: 110 Hz */
-    tas5805m_eq_registers_left_lf_120,  /* 7: 120 Hz */
-    tas5805m_eq_registers_left_lf_130,  /* 8: 130 Hz */
-    tas5805m_eq_registers_left_lf_140,  /* 9: 140 Hz */
-    tas5805m_eq_registers_left_lf_150,  /* 10: 150 Hz */
-};
-
-static const reg_sequence_eq *tas5805m_crossover_hf_registers[] = {
-    tas5805m_eq_registers_right_flat,    /* 0: OFF */
-    tas5805m_eq_registers_right_hf_60,   /* 1: 60 Hz */
-    tas5805m_eq_registers_right_hf_70,   /* 2: 70 Hz */
-    tas5805m_eq_registers_right_hf_80,   /* 3: 80 Hz */
-    tas5805m_eq_registers_right_hf_90,   /* 4: 90 Hz */
-    tas5805m_eq_registers_right_hf_100,  /* 5: 100 Hz */
-    tas5805m_eq_registers_right_hf_110,  /* 6: 110 Hz */
-    tas5805m_eq_registers_right_hf_120,  /* 7: 120 Hz */
-    tas5805m_eq_registers_right_hf_130,  /* 8: 130 Hz */
-    tas5805m_eq_registers_right_hf_140,  /* 9: 140 Hz */
-    tas5805m_eq_registers_right_hf_150,  /* 10: 150 Hz */
-};
-
-#ifdef __cplusplus
-}
-#endif
\ No newline at end of file
@@ -13,8 +13,6 @@
 //
 // It has been simplified a little and reworked for the 5.x ALSA SoC API.
 
-#define DEBUG
-
 #include <linux/module.h>
 #include <linux/moduleparam.h>
 #include <linux/kernel.h>
@@ -28,6 +26,16 @@
 #include <linux/regulator/consumer.h>
 #include <linux/atomic.h>
 #include <linux/workqueue.h>
+#include <linux/seqlock.h>
+#include <linux/ktime.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/vmalloc.h>
+#include <linux/uaccess.h>
+#include <linux/math64.h>
+#include <linux/fixp-arith.h>
+#include <linux/ctype.h>
+#include <linux/string.h>
 
 #include <sound/soc.h>
 #include <sound/pcm.h>
@@ -35,7 +43,9 @@
 #include <sound/tlv.h>
 #include "tas5805m.h"
 #include "eq/tas5805m_eq.h"
-#include "eq/tas5805m_eq_profiles.h"
+
+#define CREATE_TRACE_POINTS
+#include "tas5805m_trace.h"
 
 /* Text arrays for enum controls */
 static const char * const dac_mode_text[] = {
@@ -69,18 +79,47 @@ enum tas5805m_eq_mode_type {
 	TAS5805M_EQ_MODE_HF_CROSSOVER = 3,
 };
 
-static const char * const crossover_freq_text[] = {
-	"OFF",
-	"60 Hz",
-	"70 Hz",
-	"80 Hz",
-	"90 Hz",
-	"100 Hz",
-	"110 Hz",
-	"120 Hz",
-	"130 Hz",
-	"140 Hz",
-	"150 Hz",
+/* Crossover filter responses. Each takes one or two biquads per channel,
+ * see tas5805m_xo_q_milli.
+ */
+enum tas5805m_xo_slope {
+	TAS5805M_XO_OFF,
+	TAS5805M_XO_LR2,
+	TAS5805M_XO_LR4,
+	TAS5805M_XO_BW2,
+	TAS5805M_XO_BW4,
+};
+
+static const char * const crossover_slope_text[] = {
+	"Off",
+	"Linkwitz-Riley 12dB",
+	"Linkwitz-Riley 24dB",
+	"Butterworth 12dB",
+	"Butterworth 24dB",
+};
+
+/* Biquads of the steepest crossover filter */
+#define TAS5805M_XO_BQS			2
+
+/* Q of each second-order section in 1/1000, 0 for a flat section. LR2 is
+ * the square of a first-order Butterworth, a single section with Q 0.5;
+ * LR4 is two second-order Butterworth sections in series.
+ */
+static const unsigned int tas5805m_xo_q_milli[][TAS5805M_XO_BQS] = {
+	[TAS5805M_XO_OFF] = { 0, 0 },
+	[TAS5805M_XO_LR2] = { 500, 0 },
+	[TAS5805M_XO_LR4] = { 707, 707 },
+	[TAS5805M_XO_BW2] = { 707, 0 },
+	[TAS5805M_XO_BW4] = { 541, 1307 },
+};
+
+#define TAS5805M_XO_FREQ_MIN	20
+#define TAS5805M_XO_FREQ_MAX	20000
+#define TAS5805M_XO_FREQ_DEFAULT	80
+
+/* Centre frequencies of the 15 EQ bands in Hz, see tas5805m_eq.h */
+static const unsigned int eq_band_freq[TAS5805M_EQ_BANDS] = {
+	20, 32, 50, 80, 125, 200, 315, 500, 800, 1250, 2000, 3150, 5000, 8000, 16000,
 };
 
 static const char * const mixer_mode_text[] = {
@@ -90,6 +129,35 @@ static const char * const mixer_mode_text[] = {
 	"Right",   /* Right only: R->L, R->R at 0dB */
 };
 
+/* Volume ramp speeds. The same ramp is used up and down, for VOL_CTRL
+ * changes and the soft mute.
+ */
+static const char * const vol_ramp_text[] = {
+	"Off",
+	"4 dB/sample",
+	"2 dB/sample",
+	"1 dB/sample",
+	"0.5 dB/sample",
+	"0.25 dB/sample",
+	"0.125 dB/sample",
+};
+
+static const struct tas5805m_vol_ramp {
+	u8 bits;  /* One half of DIG_VOL_CTRL2 */
+	u8 half_db;  /* 0.5 dB steps per update, 0 for an immediate change */
+	u8 samples;  /* Samples between updates */
+} tas5805m_vol_ramps[] = {
+	{ TAS5805M_VOL_RAMP_DIRECT | TAS5805M_VOL_RAMP_0_5DB, 0, 0 },
+	{ TAS5805M_VOL_RAMP_1FS | TAS5805M_VOL_RAMP_4DB, 8, 1 },
+	{ TAS5805M_VOL_RAMP_1FS | TAS5805M_VOL_RAMP_2DB, 4, 1 },
+	{ TAS5805M_VOL_RAMP_1FS | TAS5805M_VOL_RAMP_1DB, 2, 1 },
+	{ TAS5805M_VOL_RAMP_1FS | TAS5805M_VOL_RAMP_0_5DB, 1, 1 },
+	{ TAS5805M_VOL_RAMP_2FS | TAS5805M_VOL_RAMP_0_5DB, 1, 2 },
+	{ TAS5805M_VOL_RAMP_4FS | TAS5805M_VOL_RAMP_0_5DB, 1, 4 },
+};
+
+#define TAS5805M_VOL_RAMP_DEFAULT	4  /* Device reset value */
+
 /* This sequence of register writes must always be sent, prior to the
  * 5ms delay while we wait for the DSP to boot.
  */
@@ -108,12 +176,296 @@ static const uint8_t dsp_cfg_preboot[] = {
 	TAS5805M_REG_SDOUT_SEL, TAS5805M_REG_SDOUT_SEL_PRE_DSP
 };
 
-#define SET_BOOK_AND_PAGE(rm, book, page) \
-    do { \
-        regmap_write(rm, TAS5805M_REG_PAGE_SET, TAS5805M_REG_PAGE_0); \
-        regmap_write(rm, TAS5805M_REG_BOOK_SET, book);                   \
-        regmap_write(rm, TAS5805M_REG_PAGE_SET, page);                   \
-    } while (0)
+/* Operations timed into the debugfs latency histograms */
+enum tas5805m_op {
+	TAS5805M_OP_REFRESH,
+	TAS5805M_OP_EQ_UPLOAD,
+	TAS5805M_OP_FW_UPLOAD,
+	TAS5805M_OP_FAULT_POLL,
+	TAS5805M_OP_DSP_BOOT,
+	TAS5805M_OP_FAULT_RECOVERY,
+	TAS5805M_OP_COUNT,
+};
+
+static const char * const tas5805m_op_text[] = {
+	"refresh",
+	"eq_upload",
+	"fw_upload",
+	"fault_poll",
+	"dsp_boot",
+	"recovery",
+};
+
+/* Bucket n counts durations in [2^(n-1), 2^n) us; the last one is open */
+#define TAS5805M_HIST_BUCKETS	20
+
+/* Left and right channel, the index into per-channel state */
+#define TAS5805M_CHANNELS		2
+
+/* Power states kept account of for residency, as set in DEVICE_CTRL_2 */
+enum tas5805m_power {
+	TAS5805M_POWER_SLEEP,  /* Deep sleep while DAPM has the amp down */
+	TAS5805M_POWER_HIZ,  /* Auto standby, output stage off */
+	TAS5805M_POWER_PLAY,
+	TAS5805M_POWER_COUNT
+};
+
+static const char * const tas5805m_power_names[TAS5805M_POWER_COUNT] = {
+	"deep_sleep",
+	"hiz",
+	"play",
+};
+
+/* Bus usage counters. Updated and read under the bus lock. */
+struct tas5805m_stats {
+	u64						writes;
+	u64						bulk_writes;
+	u64						reads;
+	u64						bytes;  /* Register address plus data bytes */
+	u64						page_switches;
+	u64						errors;
+	u64						bus_ns;  /* Time spent inside regmap calls */
+	u32						hist[TAS5805M_OP_COUNT][TAS5805M_HIST_BUCKETS];
+
+	/* Fault recovery, per channel and for the device */
+	u32						chan_faults[TAS5805M_CHANNELS];
+	u32						fault_retries[TAS5805M_CHANNELS];
+	u32						fault_recoveries[TAS5805M_CHANNELS];
+	u32						fault_give_ups[TAS5805M_CHANNELS];
+	u32						global_faults;  /* Each one re-initialises the device */
+	u64						recovery_us_last;  /* From the fault to the channel unmuted */
+	u64						recovery_us_max;
+
+	/* Thermal foldback */
+	u32						thermal_warnings;  /* Polls that found the warning */
+	u32						thermal_steps;  /* Steps down */
+	u32						thermal_att_max;  /* Deepest attenuation in 0.5 dB */
+	u64						thermal_us;  /* Time folded back, up to the last full restore */
+
+	/* Power state residency, up to the last change of state */
+	u64						power_us[TAS5805M_POWER_COUNT];
+	u32						power_entries[TAS5805M_POWER_COUNT];
+};
+
+/* Fault recovery. A channel with an over-current or DC fault has its
+ * mixer paths muted and the fault cleared; it is unmuted once it stays
+ * clear until the retry, and otherwise cleared again with the delay
+ * doubled, up to TAS5805M_FAULT_RETRIES times before it is left muted
+ * until the next stream start. Global faults re-initialise the device.
+ */
+#define TAS5805M_FAULT_CHAN_LEFT	(BIT(1) | BIT(3))  /* Over current, DC */
+#define TAS5805M_FAULT_CHAN_RIGHT	(BIT(0) | BIT(2))
+#define TAS5805M_FAULT_GLOBAL1		(BIT(0) | BIT(1) | BIT(6) | BIT(7))  /* Not the clock fault */
+#define TAS5805M_FAULT_BACKOFF_MS	100
+#define TAS5805M_FAULT_RETRIES		6
+
+/* Balance range in dB. At either end the opposite channel is muted. */
+#define TAS5805M_BALANCE_MAX	40
+
+/* Biquad coefficient memory in book TAS5805M_REG_BOOK_EQ: 15 biquads per
+ * channel, left then right, each 5 coefficients of 4 bytes in 5.27 format.
+ * They are packed over the 120 data bytes (0x08-0x7f) of consecutive pages
+ * from page 0x24, so a biquad may straddle two pages.
+ */
+#define TAS5805M_BQ_PAGE		0x24
+#define TAS5805M_BQ_PAGE_START	0x08
+#define TAS5805M_BQ_PAGE_BYTES	120
+#define TAS5805M_BQ_BASE		16  /* Left BQ1, bytes from page 0x24 reg 0x08 */
+#define TAS5805M_BQ_SIZE		(TAS5805M_EQ_KOEF_PER_BAND * TAS5805M_EQ_REG_PER_KOEF)
+#define TAS5805M_BQ_SLOTS		(TAS5805M_CHANNELS * TAS5805M_EQ_BANDS)
+#define TAS5805M_BQ_ONE			(1 << 27)  /* 1.0 in 5.27 */
+
+/* Room correction: parametric filters from a text firmware file named by
+ * ti,room-correction-name, as exported by REW or AutoEQ. They are designed
+ * for the stream rate when the file is loaded and again when the rate
+ * changes, and take biquads among the EQ bands like the crossover.
+ */
+enum tas5805m_rc_type {
+	TAS5805M_RC_PEAK,
+	TAS5805M_RC_LOW_SHELF,
+	TAS5805M_RC_HIGH_SHELF,
+	TAS5805M_RC_LOWPASS,
+	TAS5805M_RC_HIGHPASS,
+};
+
+struct tas5805m_rc_filter {
+	u8 type;  /* enum tas5805m_rc_type */
+	u8 channels;  /* BIT(ch) of each channel it applies to */
+	u16 q_milli;
+	s16 gain_cdb;  /* 1/100 dB */
+	u32 fc_centi;  /* 1/100 Hz */
+};
+
+#define TAS5805M_RC_MAX			TAS5805M_EQ_BANDS  /* Filters per channel */
+#define TAS5805M_RC_Q_DEFAULT	707
+#define TAS5805M_RC_GAIN_MAX	3000  /* 30 dB */
+
+/* Entries of tas5805m_priv.bq_map other than an EQ band index */
+#define TAS5805M_BQ_MAP_XO(n)	(TAS5805M_EQ_BANDS + (n))  /* Crossover section n */
+#define TAS5805M_BQ_MAP_RC(n)	TAS5805M_BQ_MAP_XO(TAS5805M_XO_BQS + (n))  /* Room correction filter n */
+#define TAS5805M_BQ_MAP_LOUD(n)	TAS5805M_BQ_MAP_RC(TAS5805M_RC_MAX + (n))  /* Loudness shelf n */
+
+/* Loudness compensation: a low and a high shelf per channel, boosted as
+ * the channel volume goes below 0 dB. The boost follows the volume in
+ * steps of TAS5805M_LOUD_STEP VOL_CTRL units (6 dB), 2 dB of bass per
+ * step and 1 dB of treble every second step, which roughly tracks the
+ * equal-loudness contours between 80 and 40 phon.
+ */
+#define TAS5805M_LOUD_BQS		2
+#define TAS5805M_LOUD_STEP		12
+#define TAS5805M_LOUD_STEPS		7
+#define TAS5805M_LOUD_BASS_FREQ		100
+#define TAS5805M_LOUD_TREBLE_FREQ	10000
+#define TAS5805M_LOUD_Q			707  /* Shelf slope 1 */
+
+/* Sections other than EQ bands a channel can have */
+#define TAS5805M_BQ_EXTRA	(TAS5805M_XO_BQS + TAS5805M_RC_MAX + TAS5805M_LOUD_BQS)
+
+/* The EQ tables are designed for this rate */
+#define TAS5805M_EQ_TABLE_RATE	48000
+
+/* Write-stream recorder. A capture, as read from the debugfs "record"
+ * file, is a tas5805m_rec_header followed by count entries, oldest first,
+ * all little endian. Every byte written to the device is one entry, tagged
+ * with the book and page selected at the time; bytes after the first of a
+ * bulk write carry TAS5805M_REC_CONT so replay can rebuild the transfers.
+ */
+#define TAS5805M_REC_ENTRIES	16384
+#define TAS5805M_REC_VERSION	1
+#define TAS5805M_REC_CONT	BIT(31)
+
+struct tas5805m_rec_entry {
+	__le32					time_us;  /* Since recording started, plus TAS5805M_REC_CONT */
+	u8						book;
+	u8						page;
+	u8						reg;
+	u8						val;
+} __packed;
+
+struct tas5805m_rec_header {
+	char					magic[4];  /* "T58R" */
+	u8						version;
+	u8						addr;  /* I2C address of the amp */
+	__le16					entry_size;
+	__le32					count;
+	__le32					lost;  /* Oldest entries overwritten by the ring */
+} __packed;
+
+struct tas5805m_recorder {
+	struct tas5805m_rec_entry	*buf;  /* TAS5805M_REC_ENTRIES, NULL until first enabled */
+	u32						count;  /* Entries recorded since enabled */
+	ktime_t					start;
+	bool					enabled;
+};
+
+/* Serial port settings, the same for every amp on the bus */
+struct tas5805m_port {
+	unsigned int			rate;  /* Stream rate, set by hw_params */
+	unsigned int			width;  /* Sample width in bits, set by hw_params */
+	unsigned int			format;  /* SAP_CTRL1 data format, set by set_fmt */
+	unsigned int			delay;  /* SCLK cycles from frame sync to data, set by set_fmt */
+	unsigned int			tdm_slots;  /* Slots per frame, 0 unless set_tdm_slot was called */
+	unsigned int			tdm_width;  /* Slot width in bits */
+};
+
+/* Coefficient blocks outside the biquad memory. Each is written in one
+ * bulk transfer.
+ */
+enum tas5805m_block {
+	TAS5805M_BLK_DRC,
+	TAS5805M_BLK_AGL,
+	TAS5805M_BLK_CLIPPER,
+	TAS5805M_BLK_VOLUME,
+	TAS5805M_BLK_COUNT,
+};
+
+#define TAS5805M_BLK_MAX		16
+
+static const struct tas5805m_block_map {
+	u8 book;
+	u8 page;
+	u8 reg;
+	u8 len;
+} tas5805m_blocks[TAS5805M_BLK_COUNT] = {
+	/* Threshold, slope, attack, release */
+	[TAS5805M_BLK_DRC] = { TAS5805M_BOOK_5, TAS5805M_BOOK_5_DYNAMICS_PAGE,
+			       TAS5805M_REG_DRC_THRESHOLD, 16 },
+	/* Release, attack, threshold */
+	[TAS5805M_BLK_AGL] = { TAS5805M_BOOK_5, TAS5805M_BOOK_5_DYNAMICS_PAGE,
+			       TAS5805M_REG_AGL_RELEASE, 12 },
+	/* Ceiling, knee start, knee curvature */
+	[TAS5805M_BLK_CLIPPER] = { TAS5805M_BOOK_5, TAS5805M_BOOK_5_DYNAMICS_PAGE,
+				   TAS5805M_REG_CLIP_CEILING, 12 },
+	/* Left and right channel volume */
+	[TAS5805M_BLK_VOLUME] = { TAS5805M_BOOK_5, TAS5805M_BOOK_5_VOLUME_PAGE,
+				  TAS5805M_REG_LEFT_VOLUME, 8 },
+};
+
+/* Dynamics block settings, DRC and AGL */
+struct tas5805m_dyn {
+	int						enable;
+	int						threshold;  /* dBFS */
+	int						ratio;  /* Compression ratio n:1, DRC only */
+	int						attack;  /* Attack time in ms */
+	int						release;  /* Release time in ms */
+};
+
+/* Thermal foldback settings */
+struct tas5805m_thermal {
+	int						enable;
+	int						step;  /* dB per step */
+	int						limit;  /* Largest attenuation in dB */
+	int						interval;  /* Time between steps in ms */
+	int						hold;  /* Time the warning must stay clear before restoring, ms */
+};
+
+/* Auto standby settings */
+struct tas5805m_standby {
+	int						enable;
+	int						timeout;  /* Silence before the output stage goes Hi-Z, s */
+	int						poll;  /* Time between checks for signal while Hi-Z, ms */
+};
+
+/* EQ curve of one channel */
+struct tas5805m_eq_curve {
+	int						band[TAS5805M_EQ_BANDS];  /* EQ band gains in dB */
+	bool					raw;  /* EQ batch with biquads in place of the band gains */
+	s32						bq[TAS5805M_EQ_BANDS][TAS5805M_EQ_KOEF_PER_BAND];  /* 5.27 */
+};
+
+/* User-visible control state. Writers (kcontrol puts, mute) update it
+ * under state_lock; readers take a lockless snapshot, so control gets never
+ * wait behind an I2C refresh holding the bus lock.
+ */
+struct tas5805m_state {
+	int						vol[TAS5805M_CHANNELS];  /* VOL_CTRL units per channel, left then right */
+	int						balance;  /* dB, positive attenuates the left channel */
+	unsigned int			vol_ramp;  /* Index into tas5805m_vol_ramps */
+	int						gain;
+	int						mixer_l2l;  /* Left to Left mixer gain in dB */
+	int						mixer_r2l;  /* Right to Left mixer gain in dB */
+	int						mixer_l2r;  /* Left to Right mixer gain in dB */
+	int						mixer_r2r;  /* Right to Right mixer gain in dB */
+	unsigned int			mixer_mode;  /* Simplified mixer mode: 0=Stereo, 1=Mono, 2=Left, 3=Right */
+	/* Crossover settings per channel, left then right. The EQ curves
+	 * are in tas5805m_priv, to keep them out of the snapshots.
+	 */
+	unsigned int			eq_mode;
+	unsigned int			crossover_freq[TAS5805M_CHANNELS];  /* Crossover frequency in Hz */
+	unsigned int			crossover_slope[TAS5805M_CHANNELS];  /* enum tas5805m_xo_slope */
+	int						loudness;  /* Volume dependent bass and treble shelves on or off */
+	int						room_correction;  /* Filters from ti,room-correction-name on or off */
+	struct tas5805m_port	port;
+	unsigned int			tdm_slot;  /* First of the two slots this amp plays in TDM mode */
+	struct tas5805m_dyn		drc;
+	struct tas5805m_dyn		agl;
+	int						clip_enable;
+	int						clip_threshold;  /* Soft clipper ceiling in dBFS */
+	int						clip_knee;  /* Width of the soft knee below the ceiling in dB */
+	struct tas5805m_thermal	thermal;
+	struct tas5805m_standby	standby;
+	bool					is_muted;
+};
 
 struct tas5805m_priv {
 	struct i2c_client		*i2c;
@@ -125,27 +477,106 @@ struct tas5805m_priv {
 
 	struct regmap			*regmap;
 
-	int						vol;
-	int						gain;
-	int						mixer_l2l;  /* Left to Left mixer gain in dB */
-	int						mixer_r2l;  /* Right to Left mixer gain in dB */
-	int						mixer_l2r;  /* Left to Right mixer gain in dB */
-	int						mixer_r2r;  /* Right to Right mixer gain in dB */
-	unsigned int			mixer_mode;  /* Simplified mixer mode: 0=Stereo, 1=Mono, 2=Left, 3=Right */
+	struct tas5805m_state	state;
+	/* EQ curve per channel, left then right. Part of the control state,
+	 * but read in place rather than copied into every snapshot.
+	 */
+	struct tas5805m_eq_curve	eq[TAS5805M_CHANNELS];
+	seqlock_t				state_lock;  /* Protects state and eq */
+
 	bool					mixer_mode_from_dt;  /* True if mixer mode is set from device tree */
-	int						eq_band[TAS5805M_EQ_BANDS];  /* EQ band gains in dB */
+	bool					tdm_slot_from_dt;
 	unsigned int			modulation_mode;
 	unsigned int			switch_freq;
 	unsigned int			bridge_mode;
-	unsigned int			eq_mode;
 	enum tas5805m_eq_mode_type	eq_mode_type;  /* EQ mode type from device tree */
-	unsigned int			crossover_freq;  /* Crossover frequency index */
+	u8						eq_batch_channel;  /* Channel of the last EQ Batch write */
 	bool					is_powered;
-	bool					is_muted;
 	bool					dsp_initialized;
+	unsigned int			applied_seq;  /* State sequence last written to the device */
+	bool					soft_muted;  /* Mute bit of DEVICE_CTRL_2 as last written */
+	ktime_t					ramp_end;  /* When the last soft mute ramp is done */
+
+	/* Channels muted for fault recovery, with when their fault was
+	 * first seen, how often it came back and when to check again
+	 */
+	u8						fault_muted;
+	ktime_t					fault_start[TAS5805M_CHANNELS];
+	unsigned int			fault_retry[TAS5805M_CHANNELS];
+	ktime_t					fault_due[TAS5805M_CHANNELS];
+	struct delayed_work		fault_work;
+
+	/* Thermal foldback: attenuation in 0.5 dB steps added to VOL_CTRL,
+	 * when the last step was taken and since when the warning is clear
+	 */
+	unsigned int			thermal_att;
+	ktime_t					thermal_step_at;
+	ktime_t					thermal_start;
+	ktime_t					thermal_clear_at;
+	bool					thermal_warned;
+	struct delayed_work		thermal_work;
+
+	/* Power state the device was last put in and since when, and since
+	 * when both channels have been found auto-muted
+	 */
+	enum tas5805m_power		power_state;
+	ktime_t					power_since;
+	bool					silent;
+	ktime_t					silent_since;
+	struct delayed_work		standby_work;
+
+	/* Coefficients last written to each biquad, valid for the slots set
+	 * in bq_valid. Cleared when the DSP is reset.
+	 */
+	u8						bq_coef[TAS5805M_BQ_SLOTS][TAS5805M_BQ_SIZE];
+	u32						bq_valid;
+
+	/* Biquads of both channels as the refresh builds them, before they
+	 * are compared with bq_coef and written
+	 */
+	u8						bq_new[TAS5805M_CHANNELS][TAS5805M_EQ_BANDS][TAS5805M_BQ_SIZE];
+
+	/* What each biquad of a channel holds: an EQ band index or
+	 * TAS5805M_BQ_MAP_XO(n), and the active EQ bands that got no biquad.
+	 * Set by the last refresh.
+	 */
+	s8						bq_map[TAS5805M_CHANNELS][TAS5805M_EQ_BANDS];
+	u32						bq_dropped[TAS5805M_CHANNELS];
+
+	/* Room correction filters of each channel placed, and left out past
+	 * the last biquad, by the last refresh
+	 */
+	u8						rc_applied[TAS5805M_CHANNELS];
+	u8						rc_dropped[TAS5805M_CHANNELS];
+
+	/* Loudness shelves last designed for each channel, for loud_step at
+	 * loud_rate, so they are only recomputed when the volume crosses into
+	 * another step. A step of -1 has none.
+	 */
+	s8						loud_step[TAS5805M_CHANNELS];
+	unsigned int			loud_rate;
+	u8						loud_bq[TAS5805M_CHANNELS][TAS5805M_LOUD_BQS][TAS5805M_BQ_SIZE];
+
+	/* Room correction filters as loaded, and their biquads for rc_rate */
+	const struct tas5805m_rc_filter	*rc_filters;
+	unsigned int			rc_count;
+	int						rc_preamp_cdb;
+	unsigned int			rc_rate;
+	u8						rc_nbq[TAS5805M_CHANNELS];
+	u8						rc_bq[TAS5805M_CHANNELS][TAS5805M_RC_MAX][TAS5805M_BQ_SIZE];
+
+	/* Same for the coefficient blocks in tas5805m_blocks */
+	u8						blk_coef[TAS5805M_BLK_COUNT][TAS5805M_BLK_MAX];
+	u32						blk_valid;
+
+	struct tas5805m_stats	stats;
+	struct tas5805m_recorder	rec;
+	u8						book;  /* Book and page selected on the device */
+	u8						page;
+	struct dentry			*debugfs;
 
 	struct work_struct		work;
-	struct mutex			lock;
+	struct mutex			lock;  /* Serializes bus access and power state */
 	struct list_head		list;  /* Linked list of all TAS5805M devices */
 };
 
@@ -153,6 +584,157 @@ struct tas5805m_priv {
 static LIST_HEAD(tas5805m_device_list);
 static DEFINE_MUTEX(tas5805m_list_mutex);
 
+/* Take a consistent copy of the control state without blocking. Returns
+ * the sequence number the copy corresponds to.
+ */
+static unsigned int tas5805m_get_state(struct tas5805m_priv *tas5805m,
+				       struct tas5805m_state *state)
+{
+	unsigned int seq;
+
+	do {
+		seq = read_seqbegin(&tas5805m->state_lock);
+		*state = tas5805m->state;
+	} while (read_seqretry(&tas5805m->state_lock, seq));
+
+	return seq;
+}
+
+/* Read size bytes of the control state at offset, for the getters that
+ * only need one field of it
+ */
+static void tas5805m_get_field(struct tas5805m_priv *tas5805m, size_t offset,
+			       void *val, size_t size)
+{
+	unsigned int seq;
+
+	do {
+		seq = read_seqbegin(&tas5805m->state_lock);
+		memcpy(val, (char *)&tas5805m->state + offset, size);
+	} while (read_seqretry(&tas5805m->state_lock, seq));
+}
+
+#define tas5805m_get_member(tas5805m, member, val) \
+	tas5805m_get_field(tas5805m, offsetof(struct tas5805m_state, member), \
+			   val, sizeof_field(struct tas5805m_state, member))
+
+/* True if the control state has changed since the snapshot taken at seq */
+static inline bool tas5805m_state_stale(struct tas5805m_priv *tas5805m,
+					unsigned int seq)
+{
+	return read_seqretry(&tas5805m->state_lock, seq);
+}
+
+/* Register access goes through these wrappers so that every transfer is
+ * accounted in the debugfs statistics. All callers hold the bus lock.
+ */
+static void tas5805m_account(struct tas5805m_priv *tas5805m, ktime_t start,
+			     int ret, unsigned int bytes)
+{
+	tas5805m->stats.bus_ns += ktime_to_ns(ktime_sub(ktime_get(), start));
+	tas5805m->stats.bytes += bytes;
+	if (ret)
+		tas5805m->stats.errors++;
+}
+
+/* Follow the book/page select state of the device and feed the recorder.
+ * Page 0 of every book has the page select at 0x00 and the book select at
+ * 0x7f; elsewhere 0x7f is plain coefficient storage.
+ */
+static void tas5805m_track(struct tas5805m_priv *tas5805m, ktime_t start,
+			   unsigned int reg, const u8 *val, size_t len)
+{
+	struct tas5805m_recorder *rec = &tas5805m->rec;
+	u32 time_us = 0;
+	size_t i;
+
+	if (rec->enabled)
+		time_us = ktime_us_delta(start, rec->start) & ~TAS5805M_REC_CONT;
+
+	for (i = 0; i < len; i++, reg++) {
+		if (rec->enabled) {
+			struct tas5805m_rec_entry *e =
+				&rec->buf[rec->count++ % TAS5805M_REC_ENTRIES];
+
+			e->time_us = cpu_to_le32(time_us | (i ? TAS5805M_REC_CONT : 0));
+			e->book = tas5805m->book;
+			e->page = tas5805m->page;
+			e->reg = reg;
+			e->val = val[i];
+		}
+
+		if (reg == TAS5805M_REG_PAGE_SET) {
+			tas5805m->page = val[i];
+		} else if (reg == TAS5805M_REG_BOOK_SET && tas5805m->page == TAS5805M_REG_PAGE_0) {
+			tas5805m->book = val[i];
+		} else if (reg == TAS5805M_REG_RESET_CTRL && tas5805m->page == TAS5805M_REG_PAGE_0 &&
+			   tas5805m->book == TAS5805M_BOOK_CONTROL_PORT &&
+			   (val[i] & TAS5805M_RESET_CONTROL_PORT)) {
+			/* Control port reset also resets the selection */
+			tas5805m->book = TAS5805M_BOOK_CONTROL_PORT;
+			tas5805m->page = TAS5805M_REG_PAGE_0;
+		}
+	}
+}
+
+static int tas5805m_write(struct tas5805m_priv *tas5805m, unsigned int reg,
+			  unsigned int val)
+{
+	ktime_t start = ktime_get();
+	int ret = regmap_write(tas5805m->regmap, reg, val);
+	u8 byte = val;
+
+	tas5805m->stats.writes++;
+	tas5805m_account(tas5805m, start, ret, 2);
+	tas5805m_track(tas5805m, start, reg, &byte, 1);
+	return ret;
+}
+
+static int tas5805m_bulk_write(struct tas5805m_priv *tas5805m, unsigned int reg,
+			       const void *val, size_t len)
+{
+	ktime_t start = ktime_get();
+	int ret = regmap_bulk_write(tas5805m->regmap, reg, val, len);
+
+	tas5805m->stats.bulk_writes++;
+	tas5805m_account(tas5805m, start, ret, 1 + len);
+	tas5805m_track(tas5805m, start, reg, val, len);
+	return ret;
+}
+
+static int tas5805m_read(struct tas5805m_priv *tas5805m, unsigned int reg,
+			 unsigned int *val)
+{
+	ktime_t start = ktime_get();
+	int ret = regmap_read(tas5805m->regmap, reg, val);
+
+	tas5805m->stats.reads++;
+	tas5805m_account(tas5805m, start, ret, 2);
+	return ret;
+}
+
+static void tas5805m_select_page(struct tas5805m_priv *tas5805m,
+				 unsigned int book, unsigned int page)
+{
+	tas5805m->stats.page_switches++;
+	tas5805m_write(tas5805m, TAS5805M_REG_PAGE_SET, TAS5805M_REG_PAGE_0);
+	tas5805m_write(tas5805m, TAS5805M_REG_BOOK_SET, book);
+	tas5805m_write(tas5805m, TAS5805M_REG_PAGE_SET, page);
+}
+
+/* Record how long an operation started at start took. Returns the
+ * duration in microseconds for the tracepoints.
+ */
+static s64 tas5805m_time_op(struct tas5805m_priv *tas5805m,
+			    enum tas5805m_op op, ktime_t start)
+{
+	s64 us = ktime_us_delta(ktime_get(), start);
+	unsigned int bucket = us > 0 ? min_t(unsigned int, fls64(us), TAS5805M_HIST_BUCKETS - 1) : 0;
+
+	tas5805m->stats.hist[op][bucket]++;
+	return us;
+}
+
 static void tas5805m_decode_faults(struct device *dev, unsigned int chan,
 				   unsigned int global1, unsigned int global2,
 				   unsigned int ot_warning)
@@ -196,8 +778,8 @@ static void tas5805m_decode_faults(struct device *dev, unsigned int chan,
 	}
 
 	if (ot_warning) {
-		if (ot_warning & BIT(2))
-			dev_warn(dev, "%s: Over temperature warning\n", __func__);
+		if (ot_warning & TAS5805M_OT_WARNING)
+			dev_dbg(dev, "%s: Over temperature warning\n", __func__);
 	}
 }
 
@@ -244,49 +826,1153 @@ static void tas5805m_map_db_to_9_23(int db_value, uint8_t buffer[4]) {
     buffer[3] = value & 0xFF;
 }
 
-static void tas5805m_refresh(struct tas5805m_priv *tas5805m)
+static s32 tas5805m_div_round(s64 num, s64 den)
 {
-	unsigned int chan, global1, global2, ot_warning;
-	struct regmap *rm = tas5805m->regmap;
-	int db_value = 24 - (tas5805m->vol / 2);  /* 0x00=+24dB, each step is 0.5dB */
-	int db_gain = -(tas5805m->gain / 2);      /* TAS5805M_AGAIN_MAX=0dB, TAS5805M_AGAIN_MIN=-15.5dB, each step is -0.5dB */
+	s64 q = div64_s64(num + (num < 0 ? -den / 2 : den / 2), den);
+
+	return clamp_t(s64, q, S32_MIN, S32_MAX);
+}
+
+/* A section whose numerator equals its denominator passes the signal as is */
+static bool tas5805m_bq_is_flat(const s32 coef[TAS5805M_EQ_KOEF_PER_BAND])
+{
+	return coef[0] == TAS5805M_BQ_ONE && coef[1] == -coef[3] && coef[2] == -coef[4];
+}
+
+/* Carry a biquad designed at TAS5805M_EQ_TABLE_RATE over to rate. The
+ * section is taken back through the bilinear transform to its analog
+ * prototype and forward again at the new rate, with the frequency warping
+ * of both transforms matched at fc, so the response around fc is kept.
+ * coef holds b0, b1, b2, a1, a2 in 5.27 with a1/a2 negated, as the DSP
+ * expects them.
+ */
+static void tas5805m_bq_convert_rate(s32 coef[TAS5805M_EQ_KOEF_PER_BAND],
+				     unsigned int fc, unsigned int rate)
+{
+	s64 b0 = coef[0], b1 = coef[1], b2 = coef[2], a1 = coef[3], a2 = coef[4];
+	s64 num[3], den[3], warp, warp2, norm;
+
+	/* Flat sections are flat at any rate */
+	if (rate == TAS5805M_EQ_TABLE_RATE || !fc || 2 * fc >= rate ||
+	    tas5805m_bq_is_flat(coef))
+		return;
+
+	/* warp = tan(pi * fc / table rate) / tan(pi * fc / rate), in Q24 */
+	warp = div64_s64((s64)fixp_sin32_rad(fc, 2 * TAS5805M_EQ_TABLE_RATE) *
+			 fixp_cos32_rad(fc, 2 * rate),
+			 ((s64)fixp_cos32_rad(fc, 2 * TAS5805M_EQ_TABLE_RATE) *
+			  fixp_sin32_rad(fc, 2 * rate)) >> 24);
+	warp2 = (warp * warp) >> 24;
+
+	/* Numerator and denominator as polynomials in (z - 1) / (z + 1),
+	 * rescaled to the new rate
+	 */
+	num[0] = b0 + b1 + b2;
+	num[1] = (2 * (b0 - b2) * warp) >> 24;
+	num[2] = ((b0 - b1 + b2) * warp2) >> 24;
+	den[0] = TAS5805M_BQ_ONE - a1 - a2;
+	den[1] = (2 * (TAS5805M_BQ_ONE + a2) * warp) >> 24;
+	den[2] = ((TAS5805M_BQ_ONE + a1 - a2) * warp2) >> 24;
+
+	/* Back to z, normalised to a0 = 1 */
+	norm = den[0] + den[1] + den[2];
+	coef[0] = tas5805m_div_round((num[0] + num[1] + num[2]) * TAS5805M_BQ_ONE, norm);
+	coef[1] = tas5805m_div_round(2 * (num[0] - num[2]) * TAS5805M_BQ_ONE, norm);
+	coef[2] = tas5805m_div_round((num[0] - num[1] + num[2]) * TAS5805M_BQ_ONE, norm);
+	coef[3] = -tas5805m_div_round(2 * (den[0] - den[2]) * TAS5805M_BQ_ONE, norm);
+	coef[4] = -tas5805m_div_round((den[0] - den[1] + den[2]) * TAS5805M_BQ_ONE, norm);
+}
+
+/* sin(pi * num / den) in Q30 for num <= den, by its Taylor series.
+ * fixp_sin32_rad() interpolates a table of whole degrees, which is too
+ * coarse for the small angles of low crossover frequencies.
+ */
+static s64 tas5805m_sin_pi(u32 num, u32 den)
+{
+	s64 x, x2, term, sum;
+	int n;
+
+	if (2 * num > den)
+		num = den - num;  /* sin(pi - x) = sin(x) */
+
+	x = div_u64((u64)num * 3373259426U, den);  /* pi in Q30 */
+	x2 = (x * x) >> 30;
+	term = sum = x;
+	for (n = 1; n <= 6; n++) {
+		term = -((term * x2) >> 30) / ((2 * n) * (2 * n + 1));
+		sum += term;
+	}
+
+	return sum;
+}
+
+/* Design one second-order low- or high-pass section at fc for rate, with
+ * Q in 1/1000, after the RBJ audio EQ cookbook. coef gets b0, b1, b2, a1,
+ * a2 in 5.27 with a1/a2 negated. Q 0, or fc at or above Nyquist, gives a
+ * flat section.
+ *
+ * 1 - cos(w0) is taken as 2 sin^2(w0 / 2), which keeps its precision at
+ * low frequencies where the cosine is too close to 1.
+ */
+static void tas5805m_bq_design_xo(s32 coef[TAS5805M_EQ_KOEF_PER_BAND],
+				  unsigned int fc, unsigned int rate,
+				  unsigned int q_milli, bool highpass)
+{
+	const s64 one = 1LL << 30;
+	s64 s2, omc, alpha, a0, b;
+
+	if (!q_milli || 2 * fc >= rate) {
+		coef[0] = TAS5805M_BQ_ONE;
+		coef[1] = coef[2] = coef[3] = coef[4] = 0;
+		return;
+	}
+
+	s2 = tas5805m_sin_pi(fc, rate);				/* sin(w0 / 2) */
+	omc = (2 * s2 * s2) >> 30;				/* 1 - cos(w0) */
+	alpha = tas5805m_sin_pi(2 * fc, rate) * 500 / q_milli;	/* sin(w0) / 2Q */
+	a0 = one + alpha;
+	b = highpass ? 2 * one - omc : omc;	/* 1 + cos(w0) for high-pass */
+
+	coef[0] = tas5805m_div_round(b * TAS5805M_BQ_ONE, 2 * a0);
+	coef[1] = tas5805m_div_round((highpass ? -b : b) * TAS5805M_BQ_ONE, a0);
+	coef[2] = coef[0];
+	coef[3] = tas5805m_div_round(2 * (one - omc) * TAS5805M_BQ_ONE, a0);
+	coef[4] = -tas5805m_div_round((one - alpha) * TAS5805M_BQ_ONE, a0);
+}
+
+static bool tas5805m_bq_cached(const struct tas5805m_priv *tas5805m,
+			       unsigned int slot, const u8 *coef)
+{
+	return (tas5805m->bq_valid & BIT(slot)) &&
+	       !memcmp(tas5805m->bq_coef[slot], coef, TAS5805M_BQ_SIZE);
+}
+
+/* Write count consecutive biquad slots from first. Slots the device
+ * already holds are skipped; each run of slots that changed goes out as
+ * one bulk write per page. Returns the number of slots written, or a
+ * negative error.
+ */
+static int tas5805m_write_bqs(struct tas5805m_priv *tas5805m, unsigned int first,
+			      unsigned int count, const u8 (*coef)[TAS5805M_BQ_SIZE])
+{
+	unsigned int lo = first, hi, end = first + count, addr, done, bytes;
+	const u8 *data;
+	int written = 0;
+	int ret;
+
+	for (;;) {
+		while (lo < end && tas5805m_bq_cached(tas5805m, lo, coef[lo - first]))
+			lo++;
+		for (hi = lo; hi < end && !tas5805m_bq_cached(tas5805m, hi, coef[hi - first]); hi++)
+			;
+		if (lo == hi)
+			return written;
+
+		tas5805m->bq_valid &= ~GENMASK(hi - 1, lo);
+
+		addr = TAS5805M_BQ_BASE + lo * TAS5805M_BQ_SIZE;
+		bytes = (hi - lo) * TAS5805M_BQ_SIZE;
+		data = coef[lo - first];
+
+		for (done = 0; done < bytes; ) {
+			unsigned int page = TAS5805M_BQ_PAGE + addr / TAS5805M_BQ_PAGE_BYTES;
+			unsigned int offset = addr % TAS5805M_BQ_PAGE_BYTES;
+			unsigned int len = min(bytes - done, TAS5805M_BQ_PAGE_BYTES - offset);
+
+			if (tas5805m->book != TAS5805M_REG_BOOK_EQ || tas5805m->page != page)
+				tas5805m_select_page(tas5805m, TAS5805M_REG_BOOK_EQ, page);
+
+			ret = tas5805m_bulk_write(tas5805m, TAS5805M_BQ_PAGE_START + offset,
+						  data + done, len);
+			if (ret)
+				return ret;
+
+			addr += len;
+			done += len;
+		}
+
+		memcpy(tas5805m->bq_coef[lo], data, bytes);
+		tas5805m->bq_valid |= GENMASK(hi - 1, lo);
+		written += hi - lo;
+		lo = hi;
+	}
+}
+
+/* Biquad slot the coefficient table entry seq belongs to */
+static unsigned int tas5805m_bq_seq_slot(const reg_sequence_eq *seq)
+{
+	unsigned int addr = (seq->page - TAS5805M_BQ_PAGE) * TAS5805M_BQ_PAGE_BYTES +
+			    seq->offset - TAS5805M_BQ_PAGE_START;
+
+	return (addr - TAS5805M_BQ_BASE) / TAS5805M_BQ_SIZE;
+}
+
+static void tas5805m_bq_pack(const s32 coef[TAS5805M_EQ_KOEF_PER_BAND],
+			     u8 buf[TAS5805M_BQ_SIZE])
+{
+	int i;
+
+	for (i = 0; i < TAS5805M_EQ_KOEF_PER_BAND; i++) {
+		buf[4 * i] = coef[i] >> 24;
+		buf[4 * i + 1] = coef[i] >> 16;
+		buf[4 * i + 2] = coef[i] >> 8;
+		buf[4 * i + 3] = coef[i];
+	}
+}
+
+/* Take the biquad starting at seq in one of the coefficient tables,
+ * converted from TAS5805M_EQ_TABLE_RATE to rate around fc
+ */
+static void tas5805m_bq_from_seq(const reg_sequence_eq *seq, unsigned int fc,
+				 unsigned int rate, u8 buf[TAS5805M_BQ_SIZE])
+{
+	s32 coef[TAS5805M_EQ_KOEF_PER_BAND];
+	int i;
+
+	for (i = 0; i < TAS5805M_EQ_KOEF_PER_BAND; i++, seq += 4)
+		coef[i] = (s32)((u32)seq[0].value << 24 | seq[1].value << 16 |
+				seq[2].value << 8 | seq[3].value);
+
+	tas5805m_bq_convert_rate(coef, fc, rate);
+	tas5805m_bq_pack(coef, buf);
+}
+
+/* Place count sections (crossover filters and loudness shelves, given by
+ * their bq_map entries) among the biquads of one channel. Every EQ band
+ * has its own slot, so map starts out as the identity. The sections take
+ * the slots of flat bands, starting from the stopband end of the
+ * crossover (the top for a low-pass, the bottom otherwise), and only when
+ * there are not enough of those the slots of active bands, in the same
+ * order. Returns the mask of active bands left out.
+ */
+static u32 tas5805m_bq_alloc(s8 map[TAS5805M_EQ_BANDS], u32 active,
+			     const s8 *sections, unsigned int count, bool lf)
+{
+	unsigned int n = 0;
+	u32 dropped = 0;
+	int pass, i;
+
+	for (i = 0; i < TAS5805M_EQ_BANDS; i++)
+		map[i] = i;
+
+	for (pass = 0; pass < 2; pass++) {
+		for (i = 0; i < TAS5805M_EQ_BANDS && n < count; i++) {
+			int band = lf ? TAS5805M_EQ_BANDS - 1 - i : i;
+
+			if (map[band] != band || (!pass && (active & BIT(band))))
+				continue;
+
+			map[band] = sections[n++];
+			dropped |= active & BIT(band);
+		}
+	}
+
+	return dropped;
+}
+
+static void tas5805m_put_coef(u8 *buf, u32 value)
+{
+	buf[0] = value >> 24;
+	buf[1] = value >> 16;
+	buf[2] = value >> 8;
+	buf[3] = value;
+}
+
+/* 10^(n/40) in 5.27 format: one 20 dB decade in 0.5 dB steps */
+static const u32 tas5805m_half_db_q27[40] = {
+	0x08000000, 0x08795a04, 0x08f9e4d0, 0x09820d75, 0x0a12477c,
+	0x0aab0d49, 0x0b4ce07c, 0x0bf84a66, 0x0caddc7b, 0x0d6e30cd,
+	0x0e39ea8e, 0x0f11b69d, 0x0ff64c17, 0x10e86cf1, 0x11e8e6a1,
+	0x12f892c7, 0x141857ea, 0x15492a38, 0x168c0c5a, 0x17e21048,
+	0x194c583b, 0x1acc179a, 0x1c629406, 0x1e112669, 0x1fd93c1f,
+	0x21bc582a, 0x23bc1479, 0x25da2346, 0x28185086, 0x2a78836f,
+	0x2cfcc016, 0x2fa72924, 0x327a01a4, 0x3577aef5, 0x38a2bacb,
+	0x3bfdd55a, 0x3f8bd79e, 0x434fc5c3, 0x474cd1b8, 0x4b865de3,
+};
+
+/* Linear gain in 9.23 format for a level in 0.5 dB steps, saturating at
+ * the largest positive value
+ */
+static u32 tas5805m_half_db_to_9_23(int half_db)
+{
+	int decades = half_db >= 0 ? half_db / 40 : -((39 - half_db) / 40);
+	u64 value = tas5805m_half_db_q27[half_db - decades * 40];
+
+	for (; decades > 0; decades--)
+		value *= 10;
+	for (; decades < 0; decades++)
+		value = div_u64(value + 5, 10);
+
+	return min_t(u64, value >> 4, S32_MAX);
+}
+
+/* 10^(mdb / 20000), the linear gain of a level in 1/1000 dB, in Q28.
+ * Whole 0.5 dB steps come from the table, the rest from the series of
+ * exp(), which is exact to well below one LSB over half a dB.
+ */
+static s64 tas5805m_mdb_to_q28(int mdb)
+{
+	int half_db = mdb >= 0 ? mdb / 500 : -((499 - mdb) / 500);
+	int decades = half_db >= 0 ? half_db / 40 : -((39 - half_db) / 40);
+	u64 value = (u64)tas5805m_half_db_q27[half_db - decades * 40] << 1;
+	s64 x = ((s64)(mdb - half_db * 500) * 126585954) >> 12;	/* ln(10) / 20000 in Q40 */
+	s64 e = (1LL << 28) + x + ((x * x) >> 29) + ((((x * x) >> 28) * x) / 6 >> 28);
+
+	for (; decades > 0; decades--)
+		value *= 10;
+	for (; decades < 0; decades++)
+		value = div_u64(value + 5, 10);
+
+	return (value * e) >> 28;
+}
+
+/* Design a low or high shelf at fc for rate, with gain_cdb of boost or cut
+ * in 1/100 dB and Q in 1/1000, after the RBJ audio EQ cookbook. fc and
+ * rate only matter as a ratio, so both may be scaled for fractional
+ * frequencies. coef gets b0, b1, b2, a1, a2 in 5.27 with a1/a2 negated;
+ * a gain of 0, or fc at or above Nyquist, gives a flat section.
+ */
+static void tas5805m_bq_design_shelf(s32 coef[TAS5805M_EQ_KOEF_PER_BAND],
+				     unsigned int fc, unsigned int rate,
+				     unsigned int q_milli, int gain_cdb, bool high)
+{
+	const s64 one = 1LL << 28;  /* Q28 keeps the products below in range */
+	int sgn = high ? -1 : 1;
+	s64 a, s2, cw, alpha, ap1, am1, amc, apc, tsa, a0;
+
+	if (!gain_cdb || !q_milli || 2 * fc >= rate) {
+		coef[0] = TAS5805M_BQ_ONE;
+		coef[1] = coef[2] = coef[3] = coef[4] = 0;
+		return;
+	}
+
+	a = tas5805m_mdb_to_q28(5 * gain_cdb);			/* 10^(gain / 40) */
+	s2 = tas5805m_sin_pi(fc, rate) >> 2;			/* sin(w0 / 2) */
+	cw = one - ((2 * s2 * s2) >> 28);			/* cos(w0) */
+	alpha = (tas5805m_sin_pi(2 * fc, rate) >> 2) * 500 / q_milli;	/* sin(w0) / 2Q */
+	ap1 = a + one;
+	am1 = a - one;
+	amc = (am1 * cw) >> 28;
+	apc = (ap1 * cw) >> 28;
+	tsa = (2 * (s64)int_sqrt64(a << 28) * alpha) >> 28;	/* 2 sqrt(A) alpha */
+	a0 = ap1 + sgn * amc + tsa;
+
+	coef[0] = tas5805m_div_round(((a * (ap1 - sgn * amc + tsa)) >> 28) * TAS5805M_BQ_ONE, a0);
+	coef[1] = tas5805m_div_round(((2 * sgn * a * (am1 - sgn * apc)) >> 28) * TAS5805M_BQ_ONE, a0);
+	coef[2] = tas5805m_div_round(((a * (ap1 - sgn * amc - tsa)) >> 28) * TAS5805M_BQ_ONE, a0);
+	coef[3] = tas5805m_div_round(2 * sgn * (am1 + sgn * apc) * TAS5805M_BQ_ONE, a0);
+	coef[4] = -tas5805m_div_round((ap1 + sgn * amc - tsa) * TAS5805M_BQ_ONE, a0);
+}
+
+/* Design a peaking section, with the same conventions as the shelves */
+static void tas5805m_bq_design_peak(s32 coef[TAS5805M_EQ_KOEF_PER_BAND],
+				    unsigned int fc, unsigned int rate,
+				    unsigned int q_milli, int gain_cdb)
+{
+	const s64 one = 1LL << 28;
+	s64 a, s2, cw, alpha, a0;
+
+	if (!gain_cdb || !q_milli || 2 * fc >= rate) {
+		coef[0] = TAS5805M_BQ_ONE;
+		coef[1] = coef[2] = coef[3] = coef[4] = 0;
+		return;
+	}
+
+	a = tas5805m_mdb_to_q28(5 * gain_cdb);			/* 10^(gain / 40) */
+	s2 = tas5805m_sin_pi(fc, rate) >> 2;			/* sin(w0 / 2) */
+	cw = one - ((2 * s2 * s2) >> 28);			/* cos(w0) */
+	alpha = (tas5805m_sin_pi(2 * fc, rate) >> 2) * 500 / q_milli;	/* sin(w0) / 2Q */
+	a0 = one + div64_s64(alpha * one, a);
+
+	coef[0] = tas5805m_div_round((one + ((alpha * a) >> 28)) * TAS5805M_BQ_ONE, a0);
+	coef[1] = tas5805m_div_round(-2 * cw * TAS5805M_BQ_ONE, a0);
+	coef[2] = tas5805m_div_round((one - ((alpha * a) >> 28)) * TAS5805M_BQ_ONE, a0);
+	coef[3] = -coef[1];
+	coef[4] = -tas5805m_div_round((one - div64_s64(alpha * one, a)) * TAS5805M_BQ_ONE, a0);
+}
+
+/* Loudness shelves of one channel for the state, designed again only when
+ * the volume step or the rate changed since the last refresh
+ */
+static const u8 (*tas5805m_loud_bqs(struct tas5805m_priv *tas5805m,
+				    const struct tas5805m_state *state,
+				    int ch))[TAS5805M_BQ_SIZE]
+{
+	int below = state->vol[ch] - TAS5805M_VOLUME_ZERO_DB;
+	int step = clamp(below / TAS5805M_LOUD_STEP, 0, TAS5805M_LOUD_STEPS);
+	s32 coef[TAS5805M_EQ_KOEF_PER_BAND];
+
+	if (tas5805m->loud_rate != state->port.rate) {
+		memset(tas5805m->loud_step, -1, sizeof(tas5805m->loud_step));
+		tas5805m->loud_rate = state->port.rate;
+	}
+
+	if (tas5805m->loud_step[ch] != step) {
+		dev_dbg(&tas5805m->i2c->dev, "%s: %s loudness step %d, bass +%ddB, treble +%ddB\n",
+			__func__, ch ? "right" : "left", step, 2 * step, step / 2);
+
+		tas5805m_bq_design_shelf(coef, TAS5805M_LOUD_BASS_FREQ, state->port.rate,
+					 TAS5805M_LOUD_Q, 200 * step, false);
+		tas5805m_bq_pack(coef, tas5805m->loud_bq[ch][0]);
+		tas5805m_bq_design_shelf(coef, TAS5805M_LOUD_TREBLE_FREQ, state->port.rate,
+					 TAS5805M_LOUD_Q, 100 * (step / 2), true);
+		tas5805m_bq_pack(coef, tas5805m->loud_bq[ch][1]);
+		tas5805m->loud_step[ch] = step;
+	}
+
+	return tas5805m->loud_bq[ch];
+}
+
+/* Parse a decimal number with an optional sign and fraction, such as
+ * "-3.5", into an integer in units of 10^-digits, rounding off further
+ * decimals
+ */
+static int tas5805m_parse_fixed(const char *s, int digits, int *val)
+{
+	bool neg = *s == '-';
+	int decimals = -1, v = 0, round = 0;
+	bool any = false;
+
+	if (*s == '-' || *s == '+')
+		s++;
+
+	for (; *s; s++) {
+		if (*s == '.' && decimals < 0) {
+			decimals = 0;
+			continue;
+		}
+		if (!isdigit(*s))
+			return -EINVAL;
+		any = true;
+
+		/* Past the precision, only the first digit counts, to round */
+		if (decimals < digits) {
+			if (v > (INT_MAX - 9) / 10)
+				return -ERANGE;
+			v = v * 10 + (*s - '0');
+		} else if (decimals == digits && *s >= '5') {
+			round = 1;
+		}
+		if (decimals >= 0)
+			decimals++;
+	}
+
+	if (!any)
+		return -EINVAL;
+
+	for (decimals = max(decimals, 0); decimals < digits; decimals++) {
+		if (v > INT_MAX / 10)
+			return -ERANGE;
+		v *= 10;
+	}
+
+	*val = neg ? -(v + round) : v + round;
+	return 0;
+}
+
+/* Next whitespace separated word of a line, NULL at its end */
+static char *tas5805m_next_word(char **line)
+{
+	char *word;
+
+	do {
+		word = strsep(line, " \t\r");
+	} while (word && !*word);
+
+	return word;
+}
+
+/* Filter types as REW and AutoEQ name them, with the Q of those that
+ * have none in the file; 0 if the file must give one
+ */
+static const struct {
+	const char *name;
+	u8 type;
+	u16 q_milli;
+} tas5805m_rc_types[] = {
+	{ "PK",  TAS5805M_RC_PEAK,       0 },
+	{ "LS",  TAS5805M_RC_LOW_SHELF,  TAS5805M_RC_Q_DEFAULT },
+	{ "LSC", TAS5805M_RC_LOW_SHELF,  TAS5805M_RC_Q_DEFAULT },
+	{ "HS",  TAS5805M_RC_HIGH_SHELF, TAS5805M_RC_Q_DEFAULT },
+	{ "HSC", TAS5805M_RC_HIGH_SHELF, TAS5805M_RC_Q_DEFAULT },
+	{ "LP",  TAS5805M_RC_LOWPASS,    TAS5805M_RC_Q_DEFAULT },
+	{ "LPQ", TAS5805M_RC_LOWPASS,    TAS5805M_RC_Q_DEFAULT },
+	{ "HP",  TAS5805M_RC_HIGHPASS,   TAS5805M_RC_Q_DEFAULT },
+	{ "HPQ", TAS5805M_RC_HIGHPASS,   TAS5805M_RC_Q_DEFAULT },
+};
+
+/* Parse one line of a room correction file:
+ *
+ *   Preamp: -6.2 dB
+ *   Channel: L
+ *   Filter 1: ON PK Fc 63.0 Hz Gain -5.0 dB Q 4.00
+ *
+ * Channel takes L, R (or 1, 2) and ALL, and selects the channels of the
+ * filters that follow it. Filters that are OFF or of type None, and
+ * lines of any other kind, are skipped. Returns 1 and fills in filter
+ * for a filter, 0 for anything else, or a negative error.
+ */
+static int tas5805m_rc_parse_line(char *line, struct tas5805m_rc_filter *filter,
+				  u8 *channels, int *preamp_cdb)
+{
+	char *word = tas5805m_next_word(&line);
+	int fc = 0, gain = 0, q = 0, ret;
+	unsigned int i;
+
+	if (!word)
+		return 0;
+
+	if (!strcasecmp(word, "Preamp:")) {
+		word = tas5805m_next_word(&line);
+		if (!word || tas5805m_parse_fixed(word, 2, preamp_cdb) ||
+		    abs(*preamp_cdb) > TAS5805M_RC_GAIN_MAX)
+			return -EINVAL;
+		return 0;
+	}
+
+	if (!strcasecmp(word, "Channel:")) {
+		*channels = 0;
+		while ((word = tas5805m_next_word(&line))) {
+			if (!strcasecmp(word, "L") || !strcmp(word, "1"))
+				*channels |= BIT(0);
+			else if (!strcasecmp(word, "R") || !strcmp(word, "2"))
+				*channels |= BIT(1);
+			else if (!strcasecmp(word, "ALL"))
+				*channels |= BIT(0) | BIT(1);
+			else
+				return -EINVAL;
+		}
+		return *channels ? 0 : -EINVAL;
+	}
+
+	/* "Filter:", "Filter 1:" or "Filter1:" */
+	if (strncasecmp(word, "Filter", 6))
+		return 0;
+	if (word[strlen(word) - 1] != ':') {
+		word = tas5805m_next_word(&line);
+		if (!word || word[strlen(word) - 1] != ':')
+			return 0;
+	}
+
+	word = tas5805m_next_word(&line);
+	if (!word || !strcasecmp(word, "OFF"))
+		return 0;
+	if (strcasecmp(word, "ON"))
+		return -EINVAL;
+
+	word = tas5805m_next_word(&line);
+	if (!word || !strcasecmp(word, "None"))
+		return 0;
+	for (i = 0; i < ARRAY_SIZE(tas5805m_rc_types); i++)
+		if (!strcasecmp(word, tas5805m_rc_types[i].name))
+			break;
+	if (i == ARRAY_SIZE(tas5805m_rc_types))
+		return -EINVAL;
+
+	/* Values follow their keywords; units and the rest are skipped */
+	while ((word = tas5805m_next_word(&line))) {
+		int *val = NULL, digits = 0;
+
+		if (!strcasecmp(word, "Fc")) {
+			val = &fc;
+			digits = 2;
+		} else if (!strcasecmp(word, "Gain")) {
+			val = &gain;
+			digits = 2;
+		} else if (!strcasecmp(word, "Q")) {
+			val = &q;
+			digits = 3;
+		}
+		if (!val)
+			continue;
+
+		word = tas5805m_next_word(&line);
+		if (!word)
+			return -EINVAL;
+		ret = tas5805m_parse_fixed(word, digits, val);
+		if (ret)
+			return ret;
+	}
+
+	if (!q)
+		q = tas5805m_rc_types[i].q_milli;
+	if (fc < 100 || fc > 2400000 || q < 100 || q > 20000 ||
+	    abs(gain) > TAS5805M_RC_GAIN_MAX)
+		return -EINVAL;
+
+	*filter = (struct tas5805m_rc_filter) {
+		.type = tas5805m_rc_types[i].type,
+		.channels = *channels,
+		.q_milli = q,
+		.gain_cdb = gain,
+		.fc_centi = fc,
+	};
+	return 1;
+}
+
+/* Load the room correction filters from tas5805m_rc_<name>.txt. The text
+ * is parsed once here; the biquads are designed by tas5805m_rc_design().
+ */
+static int tas5805m_rc_load(struct tas5805m_priv *tas5805m, const char *name)
+{
+	struct device *dev = &tas5805m->i2c->dev;
+	struct tas5805m_rc_filter *filters, filter;
+	unsigned int count = 0, nbq[TAS5805M_CHANNELS] = { 0 };
+	u8 channels = BIT(0) | BIT(1);
+	const struct firmware *fw;
+	char filename[64], *text, *s, *line;
+	int preamp = 0, lineno = 0, ret = 0;
+
+	snprintf(filename, sizeof(filename), "tas5805m_rc_%s.txt", name);
+	ret = request_firmware(&fw, filename, dev);
+	if (ret)
+		return ret;
+
+	text = kmemdup_nul((const char *)fw->data, fw->size, GFP_KERNEL);
+	release_firmware(fw);
+	if (!text)
+		return -ENOMEM;
+
+	/* Every filter takes a biquad of at least one channel */
+	filters = devm_kcalloc(dev, TAS5805M_CHANNELS * TAS5805M_RC_MAX,
+			       sizeof(*filters), GFP_KERNEL);
+	if (!filters) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	for (s = text; (line = strsep(&s, "\n")); ) {
+		lineno++;
+		ret = tas5805m_rc_parse_line(line, &filter, &channels, &preamp);
+		if (ret < 0) {
+			dev_err(dev, "%s: %s line %d is invalid\n", __func__, filename, lineno);
+			goto out;
+		}
+		if (!ret)
+			continue;
+
+		for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+			if ((filter.channels & BIT(ch)) && ++nbq[ch] > TAS5805M_RC_MAX) {
+				dev_err(dev, "%s: %s line %d: more than %d filters for the %s channel\n",
+					__func__, filename, lineno, TAS5805M_RC_MAX,
+					ch ? "right" : "left");
+				ret = -E2BIG;
+				goto out;
+			}
+		}
+		filters[count++] = filter;
+	}
+
+	dev_info(dev, "%s: %s: %u/%u filters, preamp %d.%02d dB\n", __func__,
+		 filename, nbq[0], nbq[1], preamp / 100, abs(preamp % 100));
+
+	tas5805m->rc_filters = filters;
+	tas5805m->rc_count = count;
+	tas5805m->rc_preamp_cdb = preamp;
+	ret = 0;
+out:
+	kfree(text);
+	return ret;
+}
+
+/* Design the room correction biquads of both channels for rate. The
+ * preamp is folded into the numerator of the first section of each
+ * channel, or has a section of its own if a channel has no filters.
+ */
+static void tas5805m_rc_design(struct tas5805m_priv *tas5805m, unsigned int rate)
+{
+	s64 preamp = tas5805m_mdb_to_q28(10 * tas5805m->rc_preamp_cdb);
+
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		s32 coef[TAS5805M_EQ_KOEF_PER_BAND] = { TAS5805M_BQ_ONE };
+		unsigned int n = 0;
+
+		for (unsigned int i = 0; i <= tas5805m->rc_count; i++) {
+			const struct tas5805m_rc_filter *f =
+				i < tas5805m->rc_count ? &tas5805m->rc_filters[i] : NULL;
+
+			if (!f) {
+				if (n || !tas5805m->rc_preamp_cdb)
+					break;
+				/* coef is still flat */
+			} else if (!(f->channels & BIT(ch))) {
+				continue;
+			} else if (f->type == TAS5805M_RC_PEAK) {
+				tas5805m_bq_design_peak(coef, f->fc_centi, rate * 100,
+							f->q_milli, f->gain_cdb);
+			} else if (f->type == TAS5805M_RC_LOW_SHELF ||
+				   f->type == TAS5805M_RC_HIGH_SHELF) {
+				tas5805m_bq_design_shelf(coef, f->fc_centi, rate * 100, f->q_milli,
+							 f->gain_cdb, f->type == TAS5805M_RC_HIGH_SHELF);
+			} else {
+				tas5805m_bq_design_xo(coef, f->fc_centi, rate * 100, f->q_milli,
+						      f->type == TAS5805M_RC_HIGHPASS);
+			}
+
+			if (!n)
+				for (int k = 0; k < 3; k++)
+					coef[k] = clamp_t(s64, (coef[k] * preamp) >> 28,
+							  S32_MIN, S32_MAX);
+
+			tas5805m_bq_pack(coef, tas5805m->rc_bq[ch][n++]);
+		}
+
+		tas5805m->rc_nbq[ch] = n;
+	}
+
+	dev_dbg(&tas5805m->i2c->dev, "%s: %u/%u room correction biquads at %u Hz\n",
+		__func__, tas5805m->rc_nbq[0], tas5805m->rc_nbq[1], rate);
+	tas5805m->rc_rate = rate;
+}
+
+/* Smoothing rate in 1.31 format for a time constant in ms at rate:
+ * 1 - exp(-1 / (t * fs)), from the series, which is exact to well below
+ * one LSB for time constants of 1 ms and up
+ */
+static u32 tas5805m_ms_to_rate(unsigned int ms, unsigned int rate)
+{
+	u64 x = div_u64(1000ULL << 31, ms * rate);
+	u64 x2 = (x * x) >> 31;
+	u64 x3 = (x2 * x) >> 31;
+
+	return x - x2 / 2 + x3 / 6;
+}
+
+/* Bulk write a coefficient block unless the device already holds it.
+ * Returns 0 if skipped, 1 if written, or a negative error.
+ */
+static int tas5805m_write_block(struct tas5805m_priv *tas5805m,
+				enum tas5805m_block blk, const u8 *coef)
+{
+	const struct tas5805m_block_map *map = &tas5805m_blocks[blk];
+	int ret;
+
+	if ((tas5805m->blk_valid & BIT(blk)) &&
+	    !memcmp(tas5805m->blk_coef[blk], coef, map->len))
+		return 0;
+
+	tas5805m->blk_valid &= ~BIT(blk);
+
+	if (tas5805m->book != map->book || tas5805m->page != map->page)
+		tas5805m_select_page(tas5805m, map->book, map->page);
+
+	ret = tas5805m_bulk_write(tas5805m, map->reg, coef, map->len);
+	if (ret)
+		return ret;
+
+	memcpy(tas5805m->blk_coef[blk], coef, map->len);
+	tas5805m->blk_valid |= BIT(blk);
+	return 1;
+}
+
+/* Program the DRC and AGL blocks. A disabled block gets neutral
+ * coefficients (1:1 above 0 dBFS), but only once the driver has written it
+ * since the last DSP reset, so a tuning from ti,dsp-config-name stays in
+ * place until the controls are used.
+ */
+static int tas5805m_apply_dynamics(struct tas5805m_priv *tas5805m,
+				   const struct tas5805m_state *state)
+{
+	const struct tas5805m_dyn *drc = &state->drc;
+	const struct tas5805m_dyn *agl = &state->agl;
+	unsigned int rate = state->port.rate;
+	u8 buf[TAS5805M_BLK_MAX];
+	int ret;
 
-	dev_dbg(&tas5805m->i2c->dev, "%s: is_muted=%d, vol=0x%02x (%ddB), gain=0x%02x (%ddB)\n", 
-		__func__, tas5805m->is_muted, tas5805m->vol, db_value, tas5805m->gain, db_gain);
+	if (drc->enable || (tas5805m->blk_valid & BIT(TAS5805M_BLK_DRC))) {
+		int ratio = drc->enable ? drc->ratio : 1;
 
-	SET_BOOK_AND_PAGE(rm, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
+		tas5805m_put_coef(&buf[0], tas5805m_half_db_to_9_23(drc->enable ? 2 * drc->threshold : 0));
+		/* Output level slope above the threshold, 1/ratio - 1 */
+		tas5805m_put_coef(&buf[4], (1 << 23) / ratio - (1 << 23));
+		tas5805m_put_coef(&buf[8], tas5805m_ms_to_rate(drc->attack, rate));
+		tas5805m_put_coef(&buf[12], tas5805m_ms_to_rate(drc->release, rate));
+
+		ret = tas5805m_write_block(tas5805m, TAS5805M_BLK_DRC, buf);
+		if (ret < 0)
+			return ret;
+	}
+
+	if (agl->enable || (tas5805m->blk_valid & BIT(TAS5805M_BLK_AGL))) {
+		tas5805m_put_coef(&buf[0], tas5805m_ms_to_rate(agl->release, rate));
+		tas5805m_put_coef(&buf[4], tas5805m_ms_to_rate(agl->attack, rate));
+		tas5805m_put_coef(&buf[8], tas5805m_half_db_to_9_23(agl->enable ? 2 * agl->threshold : 0));
+
+		ret = tas5805m_write_block(tas5805m, TAS5805M_BLK_AGL, buf);
+		if (ret < 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+/* Program the per-channel volume in the DSP. VOL_CTRL carries the louder
+ * channel, so the device's volume ramp covers most of any change, and the
+ * 9.23 gain of each channel takes the remaining difference plus the
+ * balance attenuation. Unity gains are only written once the block has
+ * been, so a tuning from ti,dsp-config-name keeps its channel levels.
+ */
+static int tas5805m_apply_channel_volume(struct tas5805m_priv *tas5805m,
+					 const struct tas5805m_state *state)
+{
+	int master = min(state->vol[0], state->vol[1]);
+	bool unity = true;
+	u8 buf[8];
+
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		/* Positive balance attenuates the left channel */
+		int att = ch ? -state->balance : state->balance;
+		int half_db = master - state->vol[ch];
+		u32 gain;
+
+		if (att > 0)
+			half_db -= 2 * att;
+
+		/* VOL_CTRL only mutes when both channels are at the minimum */
+		if (att >= TAS5805M_BALANCE_MAX ||
+		    state->vol[ch] == TAS5805M_VOLUME_MUTE)
+			gain = 0;
+		else
+			gain = tas5805m_half_db_to_9_23(half_db);
+
+		if (gain != tas5805m_half_db_to_9_23(0))
+			unity = false;
+		tas5805m_put_coef(&buf[4 * ch], gain);
+	}
+
+	if (unity && !(tas5805m->blk_valid & BIT(TAS5805M_BLK_VOLUME)))
+		return 0;
+
+	return tas5805m_write_block(tas5805m, TAS5805M_BLK_VOLUME, buf);
+}
+
+/* Program the soft clipper. Below the knee start L the signal passes,
+ * above it the gain bends as y = x - (x - L)^2 / (4 (T - L)) and reaches
+ * the ceiling T with zero slope. A zero knee clips hard at T. Disabled,
+ * it clips at full scale, which the output stage does anyway; as with the
+ * dynamics blocks that is only written once the switch has been used.
+ */
+static int tas5805m_apply_clipper(struct tas5805m_priv *tas5805m,
+				  const struct tas5805m_state *state)
+{
+	int threshold = state->clip_enable ? state->clip_threshold : 0;
+	int knee = state->clip_enable ? state->clip_knee : 0;
+	u32 ceiling, start;
+	u8 buf[12];
+
+	if (!state->clip_enable && !(tas5805m->blk_valid & BIT(TAS5805M_BLK_CLIPPER)))
+		return 0;
+
+	ceiling = tas5805m_half_db_to_9_23(2 * threshold);
+	start = tas5805m_half_db_to_9_23(2 * (threshold - knee));
+
+	tas5805m_put_coef(&buf[0], ceiling);
+	tas5805m_put_coef(&buf[4], start);
+	tas5805m_put_coef(&buf[8], ceiling > start ?
+			  div_u64(1ULL << 46, 4 * (ceiling - start)) : 0);
+
+	return tas5805m_write_block(tas5805m, TAS5805M_BLK_CLIPPER, buf);
+}
+
+/* Write a mixer gain into output channel out, or silence while that
+ * channel recovers from a fault
+ */
+static void tas5805m_write_mixer(struct tas5805m_priv *tas5805m, unsigned int reg,
+				 int db, int out)
+{
+	u8 buf[4] = { 0 };
+
+	if (!(tas5805m->fault_muted & BIT(out)))
+		tas5805m_map_db_to_9_23(db, buf);
+	tas5805m_bulk_write(tas5805m, reg, buf, sizeof(buf));
+}
+
+/* Act on faults that were just read and cleared: mute channels with a
+ * fault and schedule their retry, unmute those that stayed clear until
+ * it, and re-initialise the device on a global fault. The re-init is the
+ * refresh that follows with the coefficient caches dropped, so that every
+ * biquad and block is written again; the device is not power cycled.
+ */
+static void tas5805m_fault_policy(struct tas5805m_priv *tas5805m, unsigned int chan,
+				  unsigned int global1, unsigned int global2)
+{
+	static const u8 chan_mask[TAS5805M_CHANNELS] = {
+		TAS5805M_FAULT_CHAN_LEFT, TAS5805M_FAULT_CHAN_RIGHT,
+	};
+	struct device *dev = &tas5805m->i2c->dev;
+	struct tas5805m_stats *stats = &tas5805m->stats;
+	ktime_t now = ktime_get();
+	s64 next_ms = -1;
+
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		const char *name = ch ? "right" : "left";
+
+		if (chan & chan_mask[ch]) {
+			stats->chan_faults[ch]++;
+			if (!(tas5805m->fault_muted & BIT(ch))) {
+				tas5805m->fault_muted |= BIT(ch);
+				tas5805m->fault_start[ch] = now;
+				tas5805m->fault_retry[ch] = 0;
+			} else if (tas5805m->fault_retry[ch] < TAS5805M_FAULT_RETRIES) {
+				if (++tas5805m->fault_retry[ch] == TAS5805M_FAULT_RETRIES) {
+					dev_err(dev, "%s: %s channel keeps faulting, muted until the next stream\n",
+						__func__, name);
+					stats->fault_give_ups[ch]++;
+					continue;
+				}
+				stats->fault_retries[ch]++;
+			} else {
+				continue;  /* Given up on */
+			}
+
+			tas5805m->fault_due[ch] = ktime_add_ms(now,
+				TAS5805M_FAULT_BACKOFF_MS << tas5805m->fault_retry[ch]);
+			dev_warn(dev, "%s: %s channel muted, retry %u in %u ms\n", __func__, name,
+				 tas5805m->fault_retry[ch] + 1,
+				 TAS5805M_FAULT_BACKOFF_MS << tas5805m->fault_retry[ch]);
+		} else if ((tas5805m->fault_muted & BIT(ch)) &&
+			   tas5805m->fault_retry[ch] < TAS5805M_FAULT_RETRIES &&
+			   !ktime_before(now, tas5805m->fault_due[ch])) {
+			s64 us = tas5805m_time_op(tas5805m, TAS5805M_OP_FAULT_RECOVERY,
+						  tas5805m->fault_start[ch]);
+
+			tas5805m->fault_muted &= ~BIT(ch);
+			stats->fault_recoveries[ch]++;
+			stats->recovery_us_last = us;
+			stats->recovery_us_max = max_t(u64, stats->recovery_us_max, us);
+			dev_info(dev, "%s: %s channel recovered after %lld ms\n",
+				 __func__, name, div_s64(us, 1000));
+		}
+
+		/* Wake up for the earliest retry still pending */
+		if ((tas5805m->fault_muted & BIT(ch)) &&
+		    tas5805m->fault_retry[ch] < TAS5805M_FAULT_RETRIES) {
+			s64 ms = max_t(s64, DIV_ROUND_UP(ktime_us_delta(tas5805m->fault_due[ch], now), 1000), 0);
+
+			if (next_ms < 0 || ms < next_ms)
+				next_ms = ms;
+		}
+	}
+
+	if (next_ms >= 0)
+		mod_delayed_work(system_wq, &tas5805m->fault_work, msecs_to_jiffies(next_ms));
+
+	if ((global1 & TAS5805M_FAULT_GLOBAL1) || global2) {
+		dev_warn(dev, "%s: global fault, re-initialising\n", __func__);
+		stats->global_faults++;
+		tas5805m->bq_valid = 0;
+		tas5805m->blk_valid = 0;
+	}
+}
+
+/* Thermal foldback. While the over-temperature warning is up, the volume
+ * goes down a step every interval, down to the limit; once the warning
+ * has stayed clear for the hold time, it comes back up a step every
+ * interval. Each step is ramped by the device at the Volume Ramp rate.
+ * Runs at every refresh, and from thermal_work while folded back.
+ */
+static void tas5805m_thermal_update(struct tas5805m_priv *tas5805m, bool warning)
+{
+	struct device *dev = &tas5805m->i2c->dev;
+	struct tas5805m_stats *stats = &tas5805m->stats;
+	struct tas5805m_thermal thermal;
+	unsigned int att = tas5805m->thermal_att;
+	ktime_t now = ktime_get();
+	bool due;
+
+	tas5805m_get_member(tas5805m, thermal, &thermal);
+	due = !ktime_before(now, ktime_add_ms(tas5805m->thermal_step_at, thermal.interval));
+
+	if (warning) {
+		stats->thermal_warnings++;
+		tas5805m->thermal_warned = true;
+		if (thermal.enable && (due || !att))
+			att = min_t(unsigned int, att + 2 * thermal.step,
+				    2 * thermal.limit);
+	} else if (att) {
+		if (tas5805m->thermal_warned) {
+			tas5805m->thermal_warned = false;
+			tas5805m->thermal_clear_at = now;
+		}
+		if (due && !ktime_before(now, ktime_add_ms(tas5805m->thermal_clear_at,
+							    thermal.hold)))
+			att -= min_t(unsigned int, att, 2 * thermal.step);
+	}
+
+	/* Switched off, the volume is restored at once, warning or not */
+	if (!thermal.enable)
+		att = 0;
+
+	if (att != tas5805m->thermal_att) {
+		if (!tas5805m->thermal_att) {
+			dev_warn(dev, "%s: over temperature, folding back\n", __func__);
+			tas5805m->thermal_start = now;
+		}
+		if (att > tas5805m->thermal_att)
+			stats->thermal_steps++;
+		stats->thermal_att_max = max(stats->thermal_att_max, att);
+		if (!att) {
+			s64 us = ktime_us_delta(now, tas5805m->thermal_start);
+
+			stats->thermal_us += us;
+			dev_info(dev, "%s: restored after %lld ms\n", __func__, div_s64(us, 1000));
+		}
+
+		dev_dbg(dev, "%s: attenuation %u.%u dB\n", __func__, att / 2, 5 * (att % 2));
+		tas5805m->thermal_att = att;
+		tas5805m->thermal_step_at = now;
+	}
+
+	/* Keep watching while folded back or warned */
+	if (att || (warning && thermal.enable))
+		mod_delayed_work(system_wq, &tas5805m->thermal_work,
+				 msecs_to_jiffies(thermal.interval));
+}
+
+/* Account the time spent in the old power state and enter the new one */
+static void tas5805m_set_power_state(struct tas5805m_priv *tas5805m,
+				     enum tas5805m_power power_state)
+{
+	struct tas5805m_stats *stats = &tas5805m->stats;
+	ktime_t now = ktime_get();
+
+	if (power_state == tas5805m->power_state)
+		return;
+
+	stats->power_us[tas5805m->power_state] += ktime_us_delta(now, tas5805m->power_since);
+	stats->power_entries[power_state]++;
+	tas5805m->power_state = power_state;
+	tas5805m->power_since = now;
+}
+
+/* DEVICE_CTRL_2 value for a powered amp: Hi-Z in auto standby, else PLAY */
+static u8 tas5805m_device_state(const struct tas5805m_priv *tas5805m, bool muted)
+{
+	return (muted ? TAS5805M_DCTRL2_MUTE : 0) |
+	       (tas5805m->power_state == TAS5805M_POWER_HIZ ?
+		TAS5805M_DCTRL2_MODE_HIZ : TAS5805M_DCTRL2_MODE_PLAY);
+}
+
+static void tas5805m_check_faults(struct tas5805m_priv *tas5805m)
+{
+	unsigned int chan, global1, global2, ot_warning;
+	ktime_t start = ktime_get();
+
+	tas5805m_select_page(tas5805m, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
 
 	/* Validate fault states */
-	regmap_read(rm, TAS5805M_REG_CHAN_FAULT, &chan);
-	regmap_read(rm, TAS5805M_REG_GLOBAL_FAULT1, &global1);
-	regmap_read(rm, TAS5805M_REG_GLOBAL_FAULT2, &global2);
-	regmap_read(rm, TAS5805M_REG_OT_WARNING, &ot_warning);
+	tas5805m_read(tas5805m, TAS5805M_REG_CHAN_FAULT, &chan);
+	tas5805m_read(tas5805m, TAS5805M_REG_GLOBAL_FAULT1, &global1);
+	tas5805m_read(tas5805m, TAS5805M_REG_GLOBAL_FAULT2, &global2);
+	tas5805m_read(tas5805m, TAS5805M_REG_OT_WARNING, &ot_warning);
 
+	trace_tas5805m_fault(tas5805m->i2c->addr, chan, global1, global2, ot_warning);
 	tas5805m_decode_faults(&tas5805m->i2c->dev, chan, global1, global2, ot_warning);
 
 	if (chan != 0 || global1 != 0 || global2 != 0 || ot_warning != 0) {
-		dev_warn(&tas5805m->i2c->dev, "%s: fault detected: CHAN=0x%02x, GLOBAL1=0x%02x, GLOBAL2=0x%02x, OT_WARNING=0x%02x\n",
-			__func__, chan, global1, global2, ot_warning);
+		/* The warning alone is left to the thermal foldback to report */
+		if (chan || global1 || global2)
+			dev_warn(&tas5805m->i2c->dev, "%s: fault detected: CHAN=0x%02x, GLOBAL1=0x%02x, GLOBAL2=0x%02x, OT_WARNING=0x%02x\n",
+				 __func__, chan, global1, global2, ot_warning);
 
-		/* Optionally, we could take further action here, such as muting the device */
 		dev_dbg(&tas5805m->i2c->dev, "%s: clearing faults\n",
 			__func__);
-		regmap_write(rm, TAS5805M_REG_FAULT, TAS5805M_ANALOG_FAULT_CLEAR);
+		tas5805m_write(tas5805m, TAS5805M_REG_FAULT, TAS5805M_ANALOG_FAULT_CLEAR);
 	}
 
-	/* Write hardware volume register. Applies to both channels.
+	/* Also runs without a fault, to bring back channels that stayed clear */
+	if (chan || global1 || global2 || tas5805m->fault_muted)
+		tas5805m_fault_policy(tas5805m, chan, global1, global2);
+	tas5805m_thermal_update(tas5805m, ot_warning & TAS5805M_OT_WARNING);
+
+	tas5805m_time_op(tas5805m, TAS5805M_OP_FAULT_POLL, start);
+}
+
+/* SAP_CTRL1 word length for a sample or slot width, -EINVAL if the serial
+ * port cannot take it
+ */
+static int tas5805m_word_length(unsigned int width)
+{
+	switch (width) {
+	case 16:
+		return TAS5805M_SAP_WL_16;
+	case 20:
+		return TAS5805M_SAP_WL_20;
+	case 24:
+		return TAS5805M_SAP_WL_24;
+	case 32:
+		return TAS5805M_SAP_WL_32;
+	default:
+		return -EINVAL;
+	}
+}
+
+/* Time the volume ramp takes from the current volume down to mute */
+static unsigned int tas5805m_ramp_us(const struct tas5805m_state *state)
+{
+	const struct tas5805m_vol_ramp *ramp = &tas5805m_vol_ramps[state->vol_ramp];
+	unsigned int steps = TAS5805M_VOLUME_MUTE - min(state->vol[0], state->vol[1]);
+
+	if (!ramp->half_db || !state->port.rate)
+		return 0;
+
+	return div_u64((u64)steps * ramp->samples * USEC_PER_SEC,
+		       ramp->half_db * state->port.rate);
+}
+
+/* Program the device from a state snapshot. Coefficient uploads are long,
+ * so between blocks we check whether the state has moved on since seq and
+ * bail out with -EAGAIN; the caller then restarts from the latest state
+ * rather than finishing a stale intermediate one.
+ */
+static int tas5805m_apply_state(struct tas5805m_priv *tas5805m,
+				const struct tas5805m_state *state,
+				unsigned int seq)
+{
+	int master = min(state->vol[0], state->vol[1]);
+	int hw_vol;
+	int db_value = 24 - (master / 2);  /* 0x00=+24dB, each step is 0.5dB */
+	int db_gain = -(state->gain / 2);      /* TAS5805M_AGAIN_MAX=0dB, TAS5805M_AGAIN_MIN=-15.5dB, each step is -0.5dB */
+	u16 addr = tas5805m->i2c->addr;
+	unsigned int sap_ctrl1, sap_offset, sap_width;
+	u8 ramp;
+	ktime_t start = ktime_get();
+	ktime_t eq_start;
+	s64 eq_us;
+
+	dev_dbg(&tas5805m->i2c->dev, "%s: is_muted=%d, vol=0x%02x/0x%02x (%ddB), balance=%ddB, gain=0x%02x (%ddB)\n",
+		__func__, state->is_muted, state->vol[0], state->vol[1], db_value,
+		state->balance, state->gain, db_gain);
+
+	tas5805m_select_page(tas5805m, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
+
+	/* Write the volume ramp first, so that the volume change below and
+	 * the soft mute at the end already use it
+	 */
+	ramp = tas5805m_vol_ramps[state->vol_ramp].bits;
+	dev_dbg(&tas5805m->i2c->dev, "%s: writing volume ramp reg 0x%02x\n",
+				__func__, TAS5805M_VOL_RAMP(ramp, ramp));
+	tas5805m_write(tas5805m, TAS5805M_REG_DIG_VOL_CTRL2, TAS5805M_VOL_RAMP(ramp, ramp));
+
+	/* Write hardware volume register. Applies to both channels, so it
+	 * takes the louder one and the DSP volume trims the other. Thermal
+	 * foldback comes on top.
 	 * Register value 0x00=+24dB, 0x30=0dB, 0xFE=-103dB, 0xFF=Mute
 	 */
+	if (master != TAS5805M_VOLUME_MUTE)
+		hw_vol = min_t(int, master + tas5805m->thermal_att, TAS5805M_VOLUME_MIN);
+	else
+		hw_vol = master;
 	dev_dbg(&tas5805m->i2c->dev, "%s: writing volume reg 0x%02x\n",
-				__func__, tas5805m->vol);
-	regmap_write(rm, TAS5805M_REG_VOL_CTRL, tas5805m->vol);
+				__func__, hw_vol);
+	tas5805m_write(tas5805m, TAS5805M_REG_VOL_CTRL, hw_vol);
 
 	/* Write analog gain register
 	 * Register value 0=0dB, 31=-15.5dB, 0.5dB steps
 	 */
 	dev_dbg(&tas5805m->i2c->dev, "%s: writing analog gain reg 0x%02x\n",
-				__func__, tas5805m->gain);
-	regmap_write(rm, TAS5805M_REG_ANALOG_GAIN, tas5805m->gain);
+				__func__, state->gain);
+	tas5805m_write(tas5805m, TAS5805M_REG_ANALOG_GAIN, state->gain);
 
 	/* Write device control 1 register (modulation, switching freq, bridge mode)
 	 * Combine: modulation_mode (bits 1:0), bridge_mode (bit 2), switch_freq (bits 6:4)
@@ -295,145 +1981,424 @@ static void tas5805m_refresh(struct tas5805m_priv *tas5805m)
 				__func__, tas5805m->modulation_mode,
 				tas5805m->bridge_mode,
 				tas5805m->switch_freq,
-				tas5805m->eq_mode);
+				state->eq_mode);
 	unsigned int dctrl1_value = (tas5805m->modulation_mode & 0x3) |
 							   ((tas5805m->bridge_mode & 0x1) << 2) |
 							   ((tas5805m->switch_freq & 0x7) << 4);
 	dev_dbg(&tas5805m->i2c->dev, "%s: writing device ctrl 1 reg 0x%02x\n",
 				__func__, dctrl1_value);
-	regmap_write(rm, TAS5805M_REG_DEVICE_CTRL_1, dctrl1_value);
+	tas5805m_write(tas5805m, TAS5805M_REG_DEVICE_CTRL_1, dctrl1_value);
 
 	/* Write DSP misc register (EQ enable/disable)
 	 * bit 0 controls EQ
 	 */
 	dev_dbg(&tas5805m->i2c->dev, "%s: writing dsp misc reg 0x%02x\n",
-				__func__, tas5805m->eq_mode);
-	regmap_write(rm, TAS5805M_REG_DSP_MISC, tas5805m->eq_mode & 0x1);
+				__func__, state->eq_mode);
+	tas5805m_write(tas5805m, TAS5805M_REG_DSP_MISC, state->eq_mode & 0x1);
+
+	/* Write serial port control registers (data format, word length and
+	 * the data offset). In TDM mode the amp reads its two channels back to
+	 * back starting at its own slot, so the word length is the slot width.
+	 * The control port reset in do_work restores the 24-bit I2S default.
+	 */
+	sap_ctrl1 = state->port.format;
+	sap_offset = state->port.delay;
+	sap_width = state->port.width;
+	if (state->port.format == TAS5805M_SAP_FMT_TDM) {
+		sap_ctrl1 |= TAS5805M_SAP_LRCLK_PULSE;
+		if (state->port.tdm_slots) {
+			sap_offset += state->tdm_slot * state->port.tdm_width;
+			sap_width = state->port.tdm_width;
+		}
+	}
+	sap_ctrl1 |= tas5805m_word_length(sap_width);
+	if (sap_offset & BIT(8))
+		sap_ctrl1 |= TAS5805M_SAP_SHIFT_MSB;
+	dev_dbg(&tas5805m->i2c->dev, "%s: writing sap ctrl 0x%02x, offset %u\n",
+				__func__, sap_ctrl1, sap_offset);
+	tas5805m_write(tas5805m, TAS5805M_REG_SAP_CTRL1, sap_ctrl1);
+	tas5805m_write(tas5805m, TAS5805M_REG_SAP_CTRL2, sap_offset & 0xff);
+	trace_tas5805m_refresh_phase(addr, TAS5805M_PHASE_CONTROL,
+				     ktime_us_delta(ktime_get(), start));
 
 	/* Write mixer gain registers
 	 * Convert dB values to 9.23 fixed-point format and write to registers
 	 */
-	u8 mixer_buf[4];
-	SET_BOOK_AND_PAGE(rm, TAS5805M_BOOK_5, TAS5805M_BOOK_5_MIXER_PAGE);
+	start = ktime_get();
+	tas5805m_select_page(tas5805m, TAS5805M_BOOK_5, TAS5805M_BOOK_5_MIXER_PAGE);
 	
 	dev_dbg(&tas5805m->i2c->dev, "%s: mixer gains: L2L=%ddB, R2L=%ddB, L2R=%ddB, R2R=%ddB\n",
-				__func__, tas5805m->mixer_l2l, tas5805m->mixer_r2l,
-				tas5805m->mixer_l2r, tas5805m->mixer_r2r);
+				__func__, state->mixer_l2l, state->mixer_r2l,
+				state->mixer_l2r, state->mixer_r2r);
+
+	tas5805m_write_mixer(tas5805m, TAS5805M_REG_LEFT_TO_LEFT_GAIN, state->mixer_l2l, 0);
+	tas5805m_write_mixer(tas5805m, TAS5805M_REG_RIGHT_TO_LEFT_GAIN, state->mixer_r2l, 0);
+	tas5805m_write_mixer(tas5805m, TAS5805M_REG_LEFT_TO_RIGHT_GAIN, state->mixer_l2r, 1);
+	tas5805m_write_mixer(tas5805m, TAS5805M_REG_RIGHT_TO_RIGHT_GAIN, state->mixer_r2r, 1);
+
+	/* Per-channel volume and balance, next to the mixer in book 0x8c */
+	tas5805m_apply_channel_volume(tas5805m, state);
+	trace_tas5805m_refresh_phase(addr, TAS5805M_PHASE_MIXER,
+				     ktime_us_delta(ktime_get(), start));
+
+	/* Write DRC, AGL and soft clipper coefficient blocks that changed */
+	start = ktime_get();
+	dev_dbg(&tas5805m->i2c->dev, "%s: drc=%d (%ddB %d:1 %d/%dms), agl=%d (%ddB %d/%dms), clip=%d (%ddB knee %ddB)\n",
+				__func__, state->drc.enable, state->drc.threshold,
+				state->drc.ratio, state->drc.attack, state->drc.release,
+				state->agl.enable, state->agl.threshold,
+				state->agl.attack, state->agl.release,
+				state->clip_enable, state->clip_threshold, state->clip_knee);
+	tas5805m_apply_dynamics(tas5805m, state);
+	tas5805m_apply_clipper(tas5805m, state);
+	trace_tas5805m_refresh_phase(addr, TAS5805M_PHASE_DYNAMICS,
+				     ktime_us_delta(ktime_get(), start));
+
+	/* Write EQ band and crossover biquads
+	 * Apply EQ coefficients for each band based on stored dB values, for
+	 * the current stream rate, or the raw biquads of an EQ batch. In the
+	 * crossover modes the low- or high-pass sections are computed for the
+	 * stream rate and placed among the bands by tas5805m_bq_alloc(), as
+	 * are the room correction filters and the loudness shelves. Each
+	 * channel has its own curve in its own biquads, and each run of
+	 * biquads that changed goes out in one bulk write per page, so a
+	 * single band on one channel costs one transfer and a whole curve a
+	 * handful.
+	 */
+	eq_start = ktime_get();
+	if (tas5805m->eq_mode_type != TAS5805M_EQ_MODE_OFF) {
+		bool xo = tas5805m->eq_mode_type != TAS5805M_EQ_MODE_15BAND;
+		bool lf = tas5805m->eq_mode_type == TAS5805M_EQ_MODE_LF_CROSSOVER;
+		u8 (*bq)[TAS5805M_EQ_BANDS][TAS5805M_BQ_SIZE] = tas5805m->bq_new;
+		s8 map[TAS5805M_CHANNELS][TAS5805M_EQ_BANDS];
+		u32 dropped[TAS5805M_CHANNELS];
+		u8 rc_applied[TAS5805M_CHANNELS] = { 0 };
+		u8 rc_dropped[TAS5805M_CHANNELS] = { 0 };
+		unsigned int slot = tas5805m_bq_seq_slot(tas5805m_eq_registers[0]);
+
+		for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+			/* Read in place: a curve changed meanwhile makes the
+			 * state stale, and the refresh starts again
+			 */
+			const struct tas5805m_eq_curve *eq = &tas5805m->eq[ch];
+			bool raw = READ_ONCE(eq->raw);
+			/* Crossover sections, room correction filters, then
+			 * loudness shelves, by bq_map entry
+			 */
+			u8 xo_bq[TAS5805M_XO_BQS][TAS5805M_BQ_SIZE];
+			const u8 *extra[TAS5805M_BQ_EXTRA];
+			s8 sections[TAS5805M_BQ_EXTRA];
+			unsigned int slope = xo ? state->crossover_slope[ch] : TAS5805M_XO_OFF;
+			unsigned int freq = state->crossover_freq[ch];
+			unsigned int nsec = 0;
+			u32 active = 0;
+
+			dev_dbg(&tas5805m->i2c->dev, "%s: applying %s EQ (%s), %s crossover %s %u Hz, at %u Hz\n",
+				__func__, ch ? "right" : "left",
+				raw ? "biquads" : "gains",
+				lf ? "LF" : "HF", crossover_slope_text[slope], freq,
+				state->port.rate);
+
+			for (int band = 0; band < TAS5805M_EQ_BANDS; band++) {
+				int gain = READ_ONCE(eq->band[band]);
+				int row = gain + TAS5805M_EQ_MAX_DB;  /* Convert dB to array index */
+
+				/* Raw biquads are taken as designed for the stream rate */
+				if (raw)
+					tas5805m_bq_pack(eq->bq[band], bq[ch][band]);
+				else
+					tas5805m_bq_from_seq(&tas5805m_eq_registers[row][band * TAS5805M_BQ_SIZE],
+							     eq_band_freq[band], state->port.rate, bq[ch][band]);
+
+				if (raw ? !tas5805m_bq_is_flat(eq->bq[band]) : gain)
+					active |= BIT(band);
+			}
 
-	tas5805m_map_db_to_9_23(tas5805m->mixer_l2l, mixer_buf);
-	regmap_bulk_write(rm, TAS5805M_REG_LEFT_TO_LEFT_GAIN, mixer_buf, 4);
-	
-	tas5805m_map_db_to_9_23(tas5805m->mixer_r2l, mixer_buf);
-	regmap_bulk_write(rm, TAS5805M_REG_RIGHT_TO_LEFT_GAIN, mixer_buf, 4);
-	
-	tas5805m_map_db_to_9_23(tas5805m->mixer_l2r, mixer_buf);
-	regmap_bulk_write(rm, TAS5805M_REG_LEFT_TO_RIGHT_GAIN, mixer_buf, 4);
-	
-	tas5805m_map_db_to_9_23(tas5805m->mixer_r2r, mixer_buf);
-	regmap_bulk_write(rm, TAS5805M_REG_RIGHT_TO_RIGHT_GAIN, mixer_buf, 4);
+			/* Low-pass filters for LF, high-pass for HF */
+			for (int i = 0; i < TAS5805M_XO_BQS; i++) {
+				unsigned int q = tas5805m_xo_q_milli[slope][i];
+				s32 coef[TAS5805M_EQ_KOEF_PER_BAND];
 
-	/* Write EQ band registers or apply crossover
-	 * Apply EQ coefficients for each band based on stored dB values
-	 */
-	if (tas5805m->eq_mode_type == TAS5805M_EQ_MODE_15BAND) { 
-		int current_page = -1;
-		
-		dev_dbg(&tas5805m->i2c->dev, "%s: applying 15-band EQ\n", __func__);
-		
-		for (int band = 0; band < TAS5805M_EQ_BANDS; band++) {
-			int db_value = tas5805m->eq_band[band];
-			int row = db_value + TAS5805M_EQ_MAX_DB;  /* Convert dB to array index */
-			int base_offset = band * TAS5805M_EQ_KOEF_PER_BAND * TAS5805M_EQ_REG_PER_KOEF;
-			
-			for (int i = 0; i < TAS5805M_EQ_KOEF_PER_BAND * TAS5805M_EQ_REG_PER_KOEF; i++) {
-				const reg_sequence_eq *reg_value = &tas5805m_eq_registers[row][base_offset + i];
-				
-				if (reg_value->page != current_page) {
-					current_page = reg_value->page;
-					SET_BOOK_AND_PAGE(rm, TAS5805M_REG_BOOK_EQ, reg_value->page);
+				if (!q)
+					continue;
+
+				tas5805m_bq_design_xo(coef, freq, state->port.rate, q, !lf);
+
+				/* An LR2 pair only sums flat with one side
+				 * inverted: invert the high-pass
+				 */
+				if (!lf && slope == TAS5805M_XO_LR2)
+					for (int k = 0; k < 3; k++)
+						coef[k] = -coef[k];
+
+				tas5805m_bq_pack(coef, xo_bq[i]);
+				extra[nsec] = xo_bq[i];
+				sections[nsec++] = TAS5805M_BQ_MAP_XO(i);
+			}
+
+			/* Designed when the file was loaded or the rate last changed */
+			if (state->room_correction) {
+				if (tas5805m->rc_rate != state->port.rate)
+					tas5805m_rc_design(tas5805m, state->port.rate);
+
+				/* The crossover takes at most TAS5805M_XO_BQS, so
+				 * at least the first filters always fit
+				 */
+				rc_applied[ch] = min_t(unsigned int, tas5805m->rc_nbq[ch],
+						       TAS5805M_EQ_BANDS - nsec);
+				rc_dropped[ch] = tas5805m->rc_nbq[ch] - rc_applied[ch];
+
+				for (int i = 0; i < tas5805m->rc_nbq[ch]; i++) {
+					extra[nsec] = tas5805m->rc_bq[ch][i];
+					sections[nsec++] = TAS5805M_BQ_MAP_RC(i);
 				}
-				
-				regmap_write(rm, reg_value->offset, reg_value->value);
 			}
-		}
-	} else if (tas5805m->eq_mode_type == TAS5805M_EQ_MODE_LF_CROSSOVER) {
-		/* Apply LF crossover filter coefficients */
-		unsigned int freq_index = tas5805m->crossover_freq;
-		
-		if (freq_index >= ARRAY_SIZE(crossover_freq_text)) {
-			dev_warn(&tas5805m->i2c->dev, "%s: Invalid crossover frequency index %u, using OFF\n", __func__, freq_index);
-			freq_index = 0;
-		}
-		
-		dev_dbg(&tas5805m->i2c->dev, "%s: applying LF crossover filter: frequency=%s\n", 
-				__func__, crossover_freq_text[freq_index]);
-		
-		/* Get the appropriate coefficient array (low-pass filter) */
-		const reg_sequence_eq *coefficients = tas5805m_crossover_lf_registers[freq_index];
-		int current_page = -1;
-		
-		/* Apply all coefficient registers (3 bands * 5 coefficients * 4 registers = 60 registers) */
-		for (int i = 0; i < TAS5805M_EQ_PROFILE_REG_PER_STEP; i++) {
-			const reg_sequence_eq *reg_value = &coefficients[i];
-			
-			if (reg_value->page != current_page) {
-				current_page = reg_value->page;
-				SET_BOOK_AND_PAGE(rm, TAS5805M_REG_BOOK_EQ, reg_value->page);
+
+			/* The shelves keep their slots at any volume, so a
+			 * volume change only rewrites the shelves that changed
+			 */
+			if (state->loudness) {
+				const u8 (*loud)[TAS5805M_BQ_SIZE] = tas5805m_loud_bqs(tas5805m, state, ch);
+
+				for (int i = 0; i < TAS5805M_LOUD_BQS; i++) {
+					extra[nsec] = loud[i];
+					sections[nsec++] = TAS5805M_BQ_MAP_LOUD(i);
+				}
 			}
-			
-			regmap_write(rm, reg_value->offset, reg_value->value);
-		}
-	} else if (tas5805m->eq_mode_type == TAS5805M_EQ_MODE_HF_CROSSOVER) {
-		/* Apply HF crossover filter coefficients */
-		unsigned int freq_index = tas5805m->crossover_freq;
-		
-		if (freq_index >= ARRAY_SIZE(crossover_freq_text)) {
-			dev_warn(&tas5805m->i2c->dev, "%s: Invalid crossover frequency index %u, using OFF\n", __func__, freq_index);
-			freq_index = 0;
-		}
-		
-		dev_dbg(&tas5805m->i2c->dev, "%s: applying HF crossover filter: frequency=%s\n", 
-				__func__, crossover_freq_text[freq_index]);
-		
-		/* Get the appropriate coefficient array (high-pass filter) */
-		const reg_sequence_eq *coefficients = tas5805m_crossover_hf_registers[freq_index];
-		int current_page = -1;
-		
-		/* Apply all coefficient registers (3 bands * 5 coefficients * 4 registers = 60 registers) */
-		for (int i = 0; i < TAS5805M_EQ_PROFILE_REG_PER_STEP; i++) {
-			const reg_sequence_eq *reg_value = &coefficients[i];
-			
-			if (reg_value->page != current_page) {
-				current_page = reg_value->page;
-				SET_BOOK_AND_PAGE(rm, TAS5805M_REG_BOOK_EQ, reg_value->page);
+
+			/* Sections beyond the last biquad are left out, the last ones first */
+			if (nsec > TAS5805M_EQ_BANDS) {
+				dev_dbg(&tas5805m->i2c->dev, "%s: %u filter sections for %d biquads\n",
+					__func__, nsec, TAS5805M_EQ_BANDS);
+				nsec = TAS5805M_EQ_BANDS;
 			}
-			
-			regmap_write(rm, reg_value->offset, reg_value->value);
+
+			dropped[ch] = tas5805m_bq_alloc(map[ch], active, sections, nsec, lf);
+			for (int i = 0; i < TAS5805M_EQ_BANDS; i++)
+				for (unsigned int n = 0; n < nsec; n++)
+					if (map[ch][i] == sections[n])
+						memcpy(bq[ch][i], extra[n], TAS5805M_BQ_SIZE);
+		}
+
+		/* The table holds the left biquads, the right ones follow them */
+		for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+			/* Each channel is up to 15 biquad writes: stop before
+			 * the next one once a control has moved on
+			 */
+			if (tas5805m_state_stale(tas5805m, seq))
+				return -EAGAIN;
+
+			if (dropped[ch] && dropped[ch] != tas5805m->bq_dropped[ch])
+				dev_warn(&tas5805m->i2c->dev, "%s: no biquad left for %s EQ bands 0x%04x\n",
+					 __func__, ch ? "right" : "left", dropped[ch]);
+			tas5805m->bq_dropped[ch] = dropped[ch];
+
+			if (rc_dropped[ch] && rc_dropped[ch] != tas5805m->rc_dropped[ch])
+				dev_warn(&tas5805m->i2c->dev, "%s: no biquad left for %u of %u %s room correction filters\n",
+					 __func__, rc_dropped[ch], rc_applied[ch] + rc_dropped[ch],
+					 ch ? "right" : "left");
+			tas5805m->rc_applied[ch] = rc_applied[ch];
+			tas5805m->rc_dropped[ch] = rc_dropped[ch];
+			memcpy(tas5805m->bq_map[ch], map[ch], sizeof(map[ch]));
+
+			tas5805m_write_bqs(tas5805m, slot + ch * TAS5805M_EQ_BANDS,
+					   TAS5805M_EQ_BANDS, bq[ch]);
 		}
+
+		eq_us = tas5805m_time_op(tas5805m, TAS5805M_OP_EQ_UPLOAD, eq_start);
+		trace_tas5805m_refresh_phase(addr, xo ? TAS5805M_PHASE_CROSSOVER :
+					     TAS5805M_PHASE_EQ, eq_us);
 	} else {
 		dev_dbg(&tas5805m->i2c->dev, "%s: EQ mode is OFF\n", __func__);
 	}
 
 	/* Return to control port page 0 */	
-	SET_BOOK_AND_PAGE(rm, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
+	start = ktime_get();
+	tas5805m_select_page(tas5805m, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
 	
+	/* Auto standby watches for silence while on, and wakes when turned off */
+	if (state->standby.enable) {
+		if (!delayed_work_pending(&tas5805m->standby_work))
+			mod_delayed_work(system_wq, &tas5805m->standby_work,
+					 msecs_to_jiffies(TAS5805M_STANDBY_WATCH_MS));
+	} else if (tas5805m->power_state == TAS5805M_POWER_HIZ) {
+		tas5805m_set_power_state(tas5805m, TAS5805M_POWER_PLAY);
+	}
+
+	/* Make sure the auto-mute that auto standby relies on is on, a DSP
+	 * configuration may have changed it
+	 */
+	if (state->standby.enable) {
+		tas5805m_write(tas5805m, TAS5805M_REG_AUTO_MUTE_CTRL, TAS5805M_AUTO_MUTE_BOTH);
+		tas5805m_write(tas5805m, TAS5805M_REG_AUTO_MUTE_TIME, TAS5805M_AUTO_MUTE_TIME_MIN);
+	}
+
 	/* Set/clear digital soft-mute */
-	uint8_t device_state = (tas5805m->is_muted ? TAS5805M_DCTRL2_MUTE : 0) |
-			TAS5805M_DCTRL2_MODE_PLAY;
+	uint8_t device_state = tas5805m_device_state(tas5805m, state->is_muted);
 	dev_dbg(&tas5805m->i2c->dev, "%s: writing device state 0x%02x\n",
 				__func__, device_state);
-	regmap_write(rm, TAS5805M_REG_DEVICE_CTRL_2, device_state);
+	tas5805m_write(tas5805m, TAS5805M_REG_DEVICE_CTRL_2, device_state);
+	if (state->is_muted && !tas5805m->soft_muted)
+		tas5805m->ramp_end = ktime_add_us(ktime_get(), tas5805m_ramp_us(state));
+	tas5805m->soft_muted = state->is_muted;
+	trace_tas5805m_refresh_phase(addr, TAS5805M_PHASE_DEVICE_STATE,
+				     ktime_us_delta(ktime_get(), start));
+
+	return 0;
+}
+
+/* Bring the device in line with the latest control state. Called with the
+ * bus lock held.
+ */
+static void tas5805m_refresh(struct tas5805m_priv *tas5805m)
+{
+	struct tas5805m_state state;
+	unsigned int seq, restarts = 0;
+	ktime_t start = ktime_get();
+	s64 us;
+
+	tas5805m_check_faults(tas5805m);
+
+	do {
+		seq = tas5805m_get_state(tas5805m, &state);
+		if (tas5805m_apply_state(tas5805m, &state, seq) == 0)
+			break;
+
+		restarts++;
+		dev_dbg(&tas5805m->i2c->dev, "%s: state changed during upload, restarting\n",
+			__func__);
+	} while (true);
+
+	tas5805m->applied_seq = seq;
+	us = tas5805m_time_op(tas5805m, TAS5805M_OP_REFRESH, start);
+	trace_tas5805m_refresh(tas5805m->i2c->addr, restarts, us);
+}
+
+
+/* Check the channels muted for fault recovery again when their retry is
+ * due. The refresh reads the faults first and rewrites the mixer after.
+ */
+static void tas5805m_fault_work(struct work_struct *work)
+{
+	struct tas5805m_priv *tas5805m =
+		container_of(to_delayed_work(work), struct tas5805m_priv, fault_work);
+
+	mutex_lock(&tas5805m->lock);
+	if (tas5805m->is_powered && tas5805m->fault_muted)
+		tas5805m_refresh(tas5805m);
+	mutex_unlock(&tas5805m->lock);
+}
+
+/* Poll the over-temperature warning while folded back or warned */
+static void tas5805m_thermal_work(struct work_struct *work)
+{
+	struct tas5805m_priv *tas5805m =
+		container_of(to_delayed_work(work), struct tas5805m_priv, thermal_work);
+
+	mutex_lock(&tas5805m->lock);
+	if (tas5805m->is_powered)
+		tas5805m_refresh(tas5805m);
+	mutex_unlock(&tas5805m->lock);
+}
+
+/* Auto standby. The device auto-mutes a channel once its input has been
+ * digital zero for AUTO_MUTE_TIME; when both channels have stayed
+ * auto-muted for the timeout, the output stage goes Hi-Z. The DSP keeps
+ * running in Hi-Z, so the auto-mute state follows the input and a poll
+ * that finds signal back wakes the device with a single write. Polls
+ * every TAS5805M_STANDBY_WATCH_MS while playing, every poll interval in
+ * standby.
+ */
+static void tas5805m_standby_update(struct tas5805m_priv *tas5805m)
+{
+	struct device *dev = &tas5805m->i2c->dev;
+	struct tas5805m_standby standby;
+	unsigned int automute = 0;
+	ktime_t now;
+
+	tas5805m_get_member(tas5805m, standby, &standby);
+	/* The refresh that turned it off already woke the device */
+	if (!standby.enable)
+		return;
+
+	/* Everything else leaves the device on control port page 0, so a
+	 * poll is normally a single read
+	 */
+	if (tas5805m->book != TAS5805M_BOOK_CONTROL_PORT || tas5805m->page != TAS5805M_REG_PAGE_0)
+		tas5805m_select_page(tas5805m, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
+	tas5805m_read(tas5805m, TAS5805M_REG_AUTOMUTE_STATE, &automute);
+	now = ktime_get();
+
+	if ((automute & TAS5805M_AUTOMUTE_BOTH) != TAS5805M_AUTOMUTE_BOTH) {
+		tas5805m->silent = false;
+		if (tas5805m->power_state == TAS5805M_POWER_HIZ) {
+			tas5805m_set_power_state(tas5805m, TAS5805M_POWER_PLAY);
+			dev_dbg(dev, "%s: signal back, waking\n", __func__);
+			tas5805m_write(tas5805m, TAS5805M_REG_DEVICE_CTRL_2,
+				       tas5805m_device_state(tas5805m, tas5805m->soft_muted));
+		}
+	} else if (!tas5805m->silent) {
+		tas5805m->silent = true;
+		tas5805m->silent_since = now;
+	} else if (tas5805m->power_state != TAS5805M_POWER_HIZ &&
+		   !ktime_before(now, ktime_add_ms(tas5805m->silent_since,
+						   standby.timeout * MSEC_PER_SEC))) {
+		tas5805m_set_power_state(tas5805m, TAS5805M_POWER_HIZ);
+		dev_dbg(dev, "%s: silent for %d s, output stage to Hi-Z\n",
+			__func__, standby.timeout);
+		tas5805m_write(tas5805m, TAS5805M_REG_DEVICE_CTRL_2,
+			       tas5805m_device_state(tas5805m, tas5805m->soft_muted));
+	}
+
+	mod_delayed_work(system_wq, &tas5805m->standby_work,
+			 msecs_to_jiffies(tas5805m->power_state == TAS5805M_POWER_HIZ ?
+					  standby.poll : TAS5805M_STANDBY_WATCH_MS));
+}
+
+static void tas5805m_standby_work(struct work_struct *work)
+{
+	struct tas5805m_priv *tas5805m =
+		container_of(to_delayed_work(work), struct tas5805m_priv, standby_work);
+
+	mutex_lock(&tas5805m->lock);
+	if (tas5805m->is_powered)
+		tas5805m_standby_update(tas5805m);
+	mutex_unlock(&tas5805m->lock);
+}
+
+/* Push the current control state to the device, or leave it for do_work()
+ * to apply at power-up. Called after the state has been updated. Puts that
+ * queue up behind a long upload collapse into at most one more refresh.
+ */
+static void tas5805m_commit(struct tas5805m_priv *tas5805m)
+{
+	mutex_lock(&tas5805m->lock);
+	if (!tas5805m->is_powered)
+		dev_dbg(&tas5805m->i2c->dev, "%s: change deferred until power-up\n",
+			__func__);
+	else if (tas5805m_state_stale(tas5805m, tas5805m->applied_seq))
+		tas5805m_refresh(tas5805m);
+	else
+		/* A refresh done while we waited for the lock already covered it */
+		dev_dbg(&tas5805m->i2c->dev, "%s: state already applied\n",
+			__func__);
+	mutex_unlock(&tas5805m->lock);
 }
 
+/* ALSA value v is the hardware register inverted: 0 mutes, 1 is -103 dB
+ * and each step is 0.5 dB up to +24 dB at 255
+ */
+static const SNDRV_CTL_TLVD_DECLARE_DB_SCALE(tas5805m_vol_tlv, -10350, 50, 1);
+
 static int tas5805m_vol_info(struct snd_kcontrol *kcontrol,
 			     struct snd_ctl_elem_info *uinfo)
 {
 	uinfo->type = SNDRV_CTL_ELEM_TYPE_INTEGER;
-	uinfo->count = 1;
+	uinfo->count = TAS5805M_CHANNELS;
 
-	/* ALSA range: 0 (min) to 127 (max), 1dB steps */
-	uinfo->value.integer.min = TAS5805M_VOLUME_MAX;
-	uinfo->value.integer.max = TAS5805M_VOLUME_MIN / 2;
+	/* ALSA range: 0 (mute) to 255 (+24 dB), 0.5dB steps */
+	uinfo->value.integer.min = 0;
+	uinfo->value.integer.max = TAS5805M_VOLUME_MUTE - TAS5805M_VOLUME_MAX;
 	return 0;
 }
 
@@ -444,19 +2409,20 @@ static int tas5805m_vol_get(struct snd_kcontrol *kcontrol,
 		snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m =
 		snd_soc_component_get_drvdata(component);
+	int vol[TAS5805M_CHANNELS];
 
-	mutex_lock(&tas5805m->lock);
-	/* Invert and convert: hardware has 0.5dB steps, ALSA gets 1dB steps */
-	ucontrol->value.integer.value[0] = (TAS5805M_VOLUME_MIN - tas5805m->vol) / 2;
-	mutex_unlock(&tas5805m->lock);
+	tas5805m_get_member(tas5805m, vol, vol);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		ucontrol->value.integer.value[ch] =
+			TAS5805M_VOLUME_MUTE - vol[ch];
 
 	return 0;
 }
 
 static inline int volume_is_valid(int v)
 {
-	/* ALSA range: 0 to 127 (1dB steps, hardware 0xFE-0x00 is 254 steps of 0.5dB) */
-	return (v >= 0) && (v <= (TAS5805M_VOLUME_MIN / 2));
+	/* ALSA range: 0 to 255, the hardware register inverted */
+	return (v >= 0) && (v <= TAS5805M_VOLUME_MUTE - TAS5805M_VOLUME_MAX);
 }
 
 static int tas5805m_vol_put(struct snd_kcontrol *kcontrol,
@@ -466,33 +2432,32 @@ static int tas5805m_vol_put(struct snd_kcontrol *kcontrol,
 		snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m =
 		snd_soc_component_get_drvdata(component);
-	int alsa_vol = ucontrol->value.integer.value[0];
-	int hw_vol;
+	int hw_vol[TAS5805M_CHANNELS];
 	int ret = 0;
 
-	dev_dbg(component->dev, "%s: alsa_vol=%d\n", 
-		__func__, alsa_vol);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		int alsa_vol = ucontrol->value.integer.value[ch];
 
-	if (!volume_is_valid(alsa_vol))
-		return -EINVAL;
+		if (!volume_is_valid(alsa_vol))
+			return -EINVAL;
 
-	/* Convert ALSA 1dB steps to hardware 0.5dB steps and invert */
-	hw_vol = TAS5805M_VOLUME_MIN - (alsa_vol * 2);
+		hw_vol[ch] = TAS5805M_VOLUME_MUTE - alsa_vol;
+	}
 
-	mutex_lock(&tas5805m->lock);
-	if (tas5805m->vol != hw_vol) {
-		int db_value = 24 - (hw_vol / 2);  /* Calculate dB: 0x00=+24dB, each step is 0.5dB */
-		tas5805m->vol = hw_vol;
-		dev_dbg(component->dev, "%s: set vol=%d (hw_reg=0x%02x, %ddB, is_powered=%d)\n",
-			__func__, alsa_vol, hw_vol, db_value, tas5805m->is_powered);
-		if (tas5805m->is_powered)
-			tas5805m_refresh(tas5805m);
-		else
-			dev_dbg(component->dev, "%s: volume change deferred until power-up\n", 
-				__func__);
-		ret = 1;
+	write_seqlock(&tas5805m->state_lock);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		if (tas5805m->state.vol[ch] != hw_vol[ch]) {
+			tas5805m->state.vol[ch] = hw_vol[ch];
+			ret = 1;
+		}
+	}
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set vol=0x%02x/0x%02x\n",
+			__func__, hw_vol[0], hw_vol[1]);
+		tas5805m_commit(tas5805m);
 	}
-	mutex_unlock(&tas5805m->lock);
 
 	return ret;
 }
@@ -514,11 +2479,11 @@ static int tas5805m_again_get(struct snd_kcontrol *kcontrol,
 		snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m =
 		snd_soc_component_get_drvdata(component);
+	int gain;
 
-	mutex_lock(&tas5805m->lock);
+	tas5805m_get_member(tas5805m, gain, &gain);
 	/* Invert: register TAS5805M_AGAIN_MAX (0dB) -> control 31, register TAS5805M_AGAIN_MIN (-15.5dB) -> control 0 */
-	ucontrol->value.integer.value[0] = TAS5805M_AGAIN_MIN - (tas5805m->gain & TAS5805M_AGAIN_MIN);
-	mutex_unlock(&tas5805m->lock);
+	ucontrol->value.integer.value[0] = TAS5805M_AGAIN_MIN - (gain & TAS5805M_AGAIN_MIN);
 
 	return 0;
 }
@@ -540,21 +2505,19 @@ static int tas5805m_again_put(struct snd_kcontrol *kcontrol,
 	/* Invert: control 31 (0dB) -> register TAS5805M_AGAIN_MAX, control 0 (-15.5dB) -> register TAS5805M_AGAIN_MIN */
 	reg_value = TAS5805M_AGAIN_MIN - control_value;
 
-	mutex_lock(&tas5805m->lock);
-	
-	if (tas5805m->gain != reg_value) {
-		tas5805m->gain = reg_value;
-		dev_dbg(component->dev, "%s: set gain control=%u (hw_reg=0x%02x, is_powered=%d)\n",
-			__func__, control_value, reg_value, tas5805m->is_powered);
-		if (tas5805m->is_powered)
-			tas5805m_refresh(tas5805m);
-		else
-			dev_dbg(component->dev, "%s: gain change deferred until power-up\n",
-				__func__);
+	write_seqlock(&tas5805m->state_lock);
+	if (tas5805m->state.gain != reg_value) {
+		tas5805m->state.gain = reg_value;
 		ret = 1;
 	}
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set gain control=%u (hw_reg=0x%02x)\n",
+			__func__, control_value, reg_value);
+		tas5805m_commit(tas5805m);
+	}
 
-	mutex_unlock(&tas5805m->lock);
 	return ret;
 }
 
@@ -565,7 +2528,7 @@ static const SNDRV_CTL_TLVD_DECLARE_DB_SCALE(tas5805m_again_tlv, -1550, 50, 0);
 struct tas5805m_enum_ctrl {
 	const char * const *texts;
 	unsigned int num_items;
-	unsigned int offset; /* Offset in tas5805m_priv structure */
+	unsigned int offset; /* Offset in tas5805m_state structure */
 };
 
 static int tas5805m_enum_info(struct snd_kcontrol *kcontrol,
@@ -593,11 +2556,10 @@ static int tas5805m_enum_get(struct snd_kcontrol *kcontrol,
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
 	struct tas5805m_enum_ctrl *ctrl = (struct tas5805m_enum_ctrl *)kcontrol->private_value;
-	unsigned int *value_ptr = (unsigned int *)((char *)tas5805m + ctrl->offset);
+	unsigned int item;
 
-	mutex_lock(&tas5805m->lock);
-	ucontrol->value.enumerated.item[0] = *value_ptr;
-	mutex_unlock(&tas5805m->lock);
+	tas5805m_get_field(tas5805m, ctrl->offset, &item, sizeof(item));
+	ucontrol->value.enumerated.item[0] = item;
 
 	return 0;
 }
@@ -608,26 +2570,25 @@ static int tas5805m_enum_put(struct snd_kcontrol *kcontrol,
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
 	struct tas5805m_enum_ctrl *ctrl = (struct tas5805m_enum_ctrl *)kcontrol->private_value;
-	unsigned int *value_ptr = (unsigned int *)((char *)tas5805m + ctrl->offset);
+	unsigned int *value_ptr = (unsigned int *)((char *)&tas5805m->state + ctrl->offset);
 	unsigned int new_value = ucontrol->value.enumerated.item[0];
 	int ret = 0;
 
 	if (new_value >= ctrl->num_items)
 		return -EINVAL;
 
-	mutex_lock(&tas5805m->lock);
+	write_seqlock(&tas5805m->state_lock);
 	if (*value_ptr != new_value) {
 		*value_ptr = new_value;
-		dev_dbg(component->dev, "%s: set %s=%u (is_powered=%d)\n",
-				__func__, kcontrol->id.name, new_value, tas5805m->is_powered);
-		if (tas5805m->is_powered)
-			tas5805m_refresh(tas5805m);
-		else
-			dev_dbg(component->dev, "%s: change deferred until power-up\n",
-					__func__);
 		ret = 1;
 	}
-	mutex_unlock(&tas5805m->lock);
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set %s=%u\n",
+				__func__, kcontrol->id.name, new_value);
+		tas5805m_commit(tas5805m);
+	}
 
 	return ret;
 }
@@ -636,7 +2597,13 @@ static int tas5805m_enum_put(struct snd_kcontrol *kcontrol,
 static struct tas5805m_enum_ctrl eq_mode_ctrl = {
 	.texts = eq_mode_text,
 	.num_items = ARRAY_SIZE(eq_mode_text),
-	.offset = offsetof(struct tas5805m_priv, eq_mode),
+	.offset = offsetof(struct tas5805m_state, eq_mode),
+};
+
+static struct tas5805m_enum_ctrl vol_ramp_ctrl = {
+	.texts = vol_ramp_text,
+	.num_items = ARRAY_SIZE(vol_ramp_text),
+	.offset = offsetof(struct tas5805m_state, vol_ramp),
 };
 
 #define TAS5805M_ENUM(xname, xenum_ctrl) \
@@ -666,11 +2633,10 @@ static int tas5805m_mixer_get(struct snd_kcontrol *kcontrol,
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
 	unsigned int offset = kcontrol->private_value;
-	int *mixer_ptr = (int *)((char *)tas5805m + offset);
+	int val;
 
-	mutex_lock(&tas5805m->lock);
-	ucontrol->value.integer.value[0] = *mixer_ptr;
-	mutex_unlock(&tas5805m->lock);
+	tas5805m_get_field(tas5805m, offset, &val, sizeof(val));
+	ucontrol->value.integer.value[0] = val;
 
 	return 0;
 }
@@ -681,26 +2647,25 @@ static int tas5805m_mixer_put(struct snd_kcontrol *kcontrol,
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
 	unsigned int offset = kcontrol->private_value;
-	int *mixer_ptr = (int *)((char *)tas5805m + offset);
+	int *mixer_ptr = (int *)((char *)&tas5805m->state + offset);
 	int value = ucontrol->value.integer.value[0];
 	int ret = 0;
 
 	if (value < TAS5805M_MIXER_MIN_DB || value > TAS5805M_MIXER_MAX_DB)
 		return -EINVAL;
 
-	mutex_lock(&tas5805m->lock);
+	write_seqlock(&tas5805m->state_lock);
 	if (*mixer_ptr != value) {
 		*mixer_ptr = value;
-		dev_dbg(component->dev, "%s: set %s=%ddB (is_powered=%d)\n",
-				__func__, kcontrol->id.name, value, tas5805m->is_powered);
-		if (tas5805m->is_powered)
-			tas5805m_refresh(tas5805m);
-		else
-			dev_dbg(component->dev, "%s: mixer change deferred until power-up\n",
-					__func__);
 		ret = 1;
 	}
-	mutex_unlock(&tas5805m->lock);
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set %s=%ddB\n",
+				__func__, kcontrol->id.name, value);
+		tas5805m_commit(tas5805m);
+	}
 
 	return ret;
 }
@@ -713,15 +2678,119 @@ static int tas5805m_mixer_put(struct snd_kcontrol *kcontrol,
 	.info = tas5805m_mixer_info,\
 	.get = tas5805m_mixer_get,\
 	.put = tas5805m_mixer_put,\
-	.private_value = offsetof(struct tas5805m_priv, xoffset),\
+	.private_value = offsetof(struct tas5805m_state, xoffset),\
+}
+
+/* Integer parameter control handlers, for state fields described by a
+ * struct tas5805m_param. A 0..1 range makes a switch.
+ */
+struct tas5805m_param {
+	unsigned int	offset;  /* Of the int in struct tas5805m_state */
+	int				min;
+	int				max;
+};
+
+static int tas5805m_param_info(struct snd_kcontrol *kcontrol,
+						   struct snd_ctl_elem_info *uinfo)
+{
+	const struct tas5805m_param *param = (const void *)kcontrol->private_value;
+
+	uinfo->type = param->min == 0 && param->max == 1 ?
+		SNDRV_CTL_ELEM_TYPE_BOOLEAN : SNDRV_CTL_ELEM_TYPE_INTEGER;
+	uinfo->count = 1;
+	uinfo->value.integer.min = param->min;
+	uinfo->value.integer.max = param->max;
+	return 0;
 }
 
-/* EQ control handlers */
+static int tas5805m_param_get(struct snd_kcontrol *kcontrol,
+						  struct snd_ctl_elem_value *ucontrol)
+{
+	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	const struct tas5805m_param *param = (const void *)kcontrol->private_value;
+	int val;
+
+	tas5805m_get_field(tas5805m, param->offset, &val, sizeof(val));
+	ucontrol->value.integer.value[0] = val;
+
+	return 0;
+}
+
+static int tas5805m_param_put(struct snd_kcontrol *kcontrol,
+						  struct snd_ctl_elem_value *ucontrol)
+{
+	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	const struct tas5805m_param *param = (const void *)kcontrol->private_value;
+	int *ptr = (int *)((char *)&tas5805m->state + param->offset);
+	int value = ucontrol->value.integer.value[0];
+	int ret = 0;
+
+	if (value < param->min || value > param->max)
+		return -EINVAL;
+
+	write_seqlock(&tas5805m->state_lock);
+	if (*ptr != value) {
+		*ptr = value;
+		ret = 1;
+	}
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set %s=%d\n",
+				__func__, kcontrol->id.name, value);
+		tas5805m_commit(tas5805m);
+	}
+
+	return ret;
+}
+
+#define TAS5805M_PARAM(xname, xfield, xmin, xmax) \
+{\
+	.iface = SNDRV_CTL_ELEM_IFACE_MIXER,\
+	.name = xname,\
+	.access = SNDRV_CTL_ELEM_ACCESS_READWRITE,\
+	.info = tas5805m_param_info,\
+	.get = tas5805m_param_get,\
+	.put = tas5805m_param_put,\
+	.private_value = (unsigned long)&(const struct tas5805m_param) {\
+		offsetof(struct tas5805m_state, xfield), xmin, xmax },\
+}
+
+#define TAS5805M_PARAM_TLV(xname, xfield, xmin, xmax, xtlv) \
+{\
+	.iface = SNDRV_CTL_ELEM_IFACE_MIXER,\
+	.name = xname,\
+	.access = SNDRV_CTL_ELEM_ACCESS_TLV_READ |\
+		  SNDRV_CTL_ELEM_ACCESS_READWRITE,\
+	.info = tas5805m_param_info,\
+	.get = tas5805m_param_get,\
+	.put = tas5805m_param_put,\
+	.tlv.p = xtlv,\
+	.private_value = (unsigned long)&(const struct tas5805m_param) {\
+		offsetof(struct tas5805m_state, xfield), xmin, xmax },\
+}
+
+/* Thresholds in 1 dB steps, the raw value is the level in dBFS */
+static const SNDRV_CTL_TLVD_DECLARE_DB_SCALE(tas5805m_drc_threshold_tlv,
+	TAS5805M_DRC_THRESHOLD_MIN_DB * 100, 100, 0);
+static const SNDRV_CTL_TLVD_DECLARE_DB_SCALE(tas5805m_agl_threshold_tlv,
+	TAS5805M_AGL_THRESHOLD_MIN_DB * 100, 100, 0);
+static const SNDRV_CTL_TLVD_DECLARE_DB_SCALE(tas5805m_clip_threshold_tlv,
+	TAS5805M_CLIP_THRESHOLD_MIN_DB * 100, 100, 0);
+static const SNDRV_CTL_TLVD_DECLARE_DB_SCALE(tas5805m_clip_knee_tlv, 0, 100, 0);
+/* Thermal foldback step and limit: amounts of attenuation in 1 dB steps
+ * from 1 dB, like the knee width
+ */
+static const SNDRV_CTL_TLVD_DECLARE_DB_SCALE(tas5805m_thermal_tlv, 100, 100, 0);
+
+/* EQ control handlers, one value per channel: left, right */
 static int tas5805m_eq_info(struct snd_kcontrol *kcontrol,
 						   struct snd_ctl_elem_info *uinfo)
 {
 	uinfo->type = SNDRV_CTL_ELEM_TYPE_INTEGER;
-	uinfo->count = 1;
+	uinfo->count = TAS5805M_CHANNELS;
 	uinfo->value.integer.min = TAS5805M_EQ_MIN_DB;
 	uinfo->value.integer.max = TAS5805M_EQ_MAX_DB;
 	return 0;
@@ -737,108 +2806,319 @@ static int tas5805m_eq_get(struct snd_kcontrol *kcontrol,
 	if (band_index >= TAS5805M_EQ_BANDS)
 		return -EINVAL;
 
-	mutex_lock(&tas5805m->lock);
-	ucontrol->value.integer.value[0] = tas5805m->eq_band[band_index];
-	mutex_unlock(&tas5805m->lock);
+	unsigned int seq;
+
+	do {
+		seq = read_seqbegin(&tas5805m->state_lock);
+		for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+			ucontrol->value.integer.value[ch] = tas5805m->eq[ch].band[band_index];
+	} while (read_seqretry(&tas5805m->state_lock, seq));
+
+	return 0;
+}
+
+static int tas5805m_eq_put(struct snd_kcontrol *kcontrol,
+						  struct snd_ctl_elem_value *ucontrol)
+{
+	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	unsigned int band_index = kcontrol->private_value;
+	long *value = ucontrol->value.integer.value;
+	int ret = 0;
+
+	if (band_index >= TAS5805M_EQ_BANDS)
+		return -EINVAL;
+
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		if (value[ch] < TAS5805M_EQ_MIN_DB || value[ch] > TAS5805M_EQ_MAX_DB)
+			return -EINVAL;
+
+	/* Moving a band slider leaves the raw biquads of an EQ batch, on
+	 * the channel it moved on
+	 */
+	write_seqlock(&tas5805m->state_lock);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		if (tas5805m->eq[ch].band[band_index] != value[ch]) {
+			tas5805m->eq[ch].band[band_index] = value[ch];
+			tas5805m->eq[ch].raw = false;
+			ret = 1;
+		}
+	}
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set %s=%ld,%lddB\n",
+				__func__, kcontrol->id.name, value[0], value[1]);
+		tas5805m_commit(tas5805m);
+	}
+
+	return ret;
+}
+
+#define TAS5805M_EQ_BAND(xname, xband) \
+{\
+	.iface = SNDRV_CTL_ELEM_IFACE_MIXER,\
+	.name = xname,\
+	.access = SNDRV_CTL_ELEM_ACCESS_READWRITE,\
+	.info = tas5805m_eq_info,\
+	.get = tas5805m_eq_get,\
+	.put = tas5805m_eq_put,\
+	.private_value = xband,\
+}
+
+/* EQ batch control: the whole 15-band EQ of one or both channels in one
+ * write and one refresh. Values are little endian. Biquads are in the
+ * DSP's 5.27 format and sign convention (b0, b1, b2, a1, a2 with the
+ * feedback terms negated) and are used as designed for the stream rate.
+ *
+ * A read returns the channel the last write addressed, the left one
+ * after a write to both unless the channels differ.
+ */
+#define TAS5805M_EQ_BATCH_GAINS		0
+#define TAS5805M_EQ_BATCH_BIQUADS	1
+
+#define TAS5805M_EQ_BATCH_BOTH		0
+#define TAS5805M_EQ_BATCH_LEFT		1
+#define TAS5805M_EQ_BATCH_RIGHT		2
+
+struct tas5805m_eq_batch {
+	u8		format;
+	u8		channel;
+	u8		reserved[2];
+	union {
+		__le32	gain[TAS5805M_EQ_BANDS];  /* dB */
+		__le32	coef[TAS5805M_EQ_BANDS][TAS5805M_EQ_KOEF_PER_BAND];
+	};
+} __packed;
+
+static int tas5805m_eq_batch_get(struct snd_kcontrol *kcontrol,
+						  struct snd_ctl_elem_value *ucontrol)
+{
+	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	struct tas5805m_eq_batch *batch = (void *)ucontrol->value.bytes.data;
+	const struct tas5805m_eq_curve *eq = tas5805m->eq;
+	u8 channel, last = READ_ONCE(tas5805m->eq_batch_channel);
+	unsigned int seq;
+	int band, i, ch;
+
+	ch = last == TAS5805M_EQ_BATCH_RIGHT;
+	do {
+		seq = read_seqbegin(&tas5805m->state_lock);
+
+		channel = last;
+		if (channel == TAS5805M_EQ_BATCH_BOTH &&
+		    (eq[0].raw != eq[1].raw ||
+		     (eq[0].raw ?
+		      memcmp(eq[0].bq, eq[1].bq, sizeof(eq[0].bq)) :
+		      memcmp(eq[0].band, eq[1].band, sizeof(eq[0].band)))))
+			channel = TAS5805M_EQ_BATCH_LEFT;
+
+		memset(batch, 0, sizeof(*batch));
+		batch->channel = channel;
+		if (eq[ch].raw) {
+			batch->format = TAS5805M_EQ_BATCH_BIQUADS;
+			for (band = 0; band < TAS5805M_EQ_BANDS; band++)
+				for (i = 0; i < TAS5805M_EQ_KOEF_PER_BAND; i++)
+					batch->coef[band][i] = cpu_to_le32(eq[ch].bq[band][i]);
+		} else {
+			batch->format = TAS5805M_EQ_BATCH_GAINS;
+			for (band = 0; band < TAS5805M_EQ_BANDS; band++)
+				batch->gain[band] = cpu_to_le32(eq[ch].band[band]);
+		}
+	} while (read_seqretry(&tas5805m->state_lock, seq));
+
+	return 0;
+}
+
+static int tas5805m_eq_batch_put(struct snd_kcontrol *kcontrol,
+						  struct snd_ctl_elem_value *ucontrol)
+{
+	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	const struct tas5805m_eq_batch *batch = (const void *)ucontrol->value.bytes.data;
+	s32 coef[TAS5805M_EQ_BANDS][TAS5805M_EQ_KOEF_PER_BAND];
+	int gain[TAS5805M_EQ_BANDS];
+	unsigned int channels;
+	bool raw;
+	int band, i, ch, ret = 0;
+
+	switch (batch->channel) {
+	case TAS5805M_EQ_BATCH_BOTH:
+		channels = BIT(0) | BIT(1);
+		break;
+	case TAS5805M_EQ_BATCH_LEFT:
+		channels = BIT(0);
+		break;
+	case TAS5805M_EQ_BATCH_RIGHT:
+		channels = BIT(1);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	switch (batch->format) {
+	case TAS5805M_EQ_BATCH_GAINS:
+		raw = false;
+		for (band = 0; band < TAS5805M_EQ_BANDS; band++) {
+			gain[band] = (s32)le32_to_cpu(batch->gain[band]);
+			if (gain[band] < TAS5805M_EQ_MIN_DB || gain[band] > TAS5805M_EQ_MAX_DB)
+				return -EINVAL;
+		}
+		break;
+	case TAS5805M_EQ_BATCH_BIQUADS:
+		raw = true;
+		for (band = 0; band < TAS5805M_EQ_BANDS; band++)
+			for (i = 0; i < TAS5805M_EQ_KOEF_PER_BAND; i++)
+				coef[band][i] = (s32)le32_to_cpu(batch->coef[band][i]);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	WRITE_ONCE(tas5805m->eq_batch_channel, batch->channel);
+
+	write_seqlock(&tas5805m->state_lock);
+	for (ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		if (!(channels & BIT(ch)))
+			continue;
+
+		if (raw) {
+			if (!tas5805m->eq[ch].raw ||
+			    memcmp(tas5805m->eq[ch].bq, coef, sizeof(coef))) {
+				memcpy(tas5805m->eq[ch].bq, coef, sizeof(coef));
+				tas5805m->eq[ch].raw = true;
+				ret = 1;
+			}
+		} else if (tas5805m->eq[ch].raw ||
+			   memcmp(tas5805m->eq[ch].band, gain, sizeof(gain))) {
+			memcpy(tas5805m->eq[ch].band, gain, sizeof(gain));
+			tas5805m->eq[ch].raw = false;
+			ret = 1;
+		}
+	}
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set %s on channel mask 0x%x\n", __func__,
+				raw ? "biquads" : "gains", channels);
+		tas5805m_commit(tas5805m);
+	}
+
+	return ret;
+}
+
+/* Crossover control handlers, one value per channel: left, right */
+static int tas5805m_crossover_freq_info(struct snd_kcontrol *kcontrol,
+					struct snd_ctl_elem_info *uinfo)
+{
+	uinfo->type = SNDRV_CTL_ELEM_TYPE_INTEGER;
+	uinfo->count = TAS5805M_CHANNELS;
+	uinfo->value.integer.min = TAS5805M_XO_FREQ_MIN;
+	uinfo->value.integer.max = TAS5805M_XO_FREQ_MAX;
+	return 0;
+}
+
+static int tas5805m_crossover_freq_get(struct snd_kcontrol *kcontrol,
+				       struct snd_ctl_elem_value *ucontrol)
+{
+	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	unsigned int freq[TAS5805M_CHANNELS];
+
+	tas5805m_get_member(tas5805m, crossover_freq, freq);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		ucontrol->value.integer.value[ch] = freq[ch];
 
 	return 0;
 }
 
-static int tas5805m_eq_put(struct snd_kcontrol *kcontrol,
-						  struct snd_ctl_elem_value *ucontrol)
+static int tas5805m_crossover_freq_put(struct snd_kcontrol *kcontrol,
+				       struct snd_ctl_elem_value *ucontrol)
 {
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
-	unsigned int band_index = kcontrol->private_value;
-	int value = ucontrol->value.integer.value[0];
+	long *val = ucontrol->value.integer.value;
 	int ret = 0;
 
-	if (band_index >= TAS5805M_EQ_BANDS)
-		return -EINVAL;
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		if (val[ch] < TAS5805M_XO_FREQ_MIN || val[ch] > TAS5805M_XO_FREQ_MAX)
+			return -EINVAL;
 
-	if (value < TAS5805M_EQ_MIN_DB || value > TAS5805M_EQ_MAX_DB)
-		return -EINVAL;
+	write_seqlock(&tas5805m->state_lock);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		if (tas5805m->state.crossover_freq[ch] != val[ch]) {
+			tas5805m->state.crossover_freq[ch] = val[ch];
+			ret = 1;
+		}
+	}
+	write_sequnlock(&tas5805m->state_lock);
 
-	mutex_lock(&tas5805m->lock);
-	if (tas5805m->eq_band[band_index] != value) {
-		tas5805m->eq_band[band_index] = value;
-		dev_dbg(component->dev, "%s: set %s=%ddB (is_powered=%d)\n",
-				__func__, kcontrol->id.name, value, tas5805m->is_powered);
-		if (tas5805m->is_powered)
-			tas5805m_refresh(tas5805m);
-		else
-			dev_dbg(component->dev, "%s: EQ change deferred until power-up\n",
-					__func__);
-		ret = 1;
+	if (ret) {
+		dev_dbg(component->dev, "%s: set crossover=%ld,%ld Hz\n", __func__,
+				val[0], val[1]);
+		tas5805m_commit(tas5805m);
 	}
-	mutex_unlock(&tas5805m->lock);
 
 	return ret;
 }
 
-#define TAS5805M_EQ_BAND(xname, xband) \
-{\
-	.iface = SNDRV_CTL_ELEM_IFACE_MIXER,\
-	.name = xname,\
-	.access = SNDRV_CTL_ELEM_ACCESS_READWRITE,\
-	.info = tas5805m_eq_info,\
-	.get = tas5805m_eq_get,\
-	.put = tas5805m_eq_put,\
-	.private_value = xband,\
-}
-
-/* Crossover control handlers */
-static int tas5805m_crossover_info(struct snd_kcontrol *kcontrol,
-				   struct snd_ctl_elem_info *uinfo)
+static int tas5805m_crossover_slope_info(struct snd_kcontrol *kcontrol,
+					 struct snd_ctl_elem_info *uinfo)
 {
 	uinfo->type = SNDRV_CTL_ELEM_TYPE_ENUMERATED;
-	uinfo->count = 1;
-	uinfo->value.enumerated.items = ARRAY_SIZE(crossover_freq_text);
+	uinfo->count = TAS5805M_CHANNELS;
+	uinfo->value.enumerated.items = ARRAY_SIZE(crossover_slope_text);
 
 	if (uinfo->value.enumerated.item >= uinfo->value.enumerated.items)
 		uinfo->value.enumerated.item = uinfo->value.enumerated.items - 1;
 
 	strcpy(uinfo->value.enumerated.name,
-	       crossover_freq_text[uinfo->value.enumerated.item]);
+	       crossover_slope_text[uinfo->value.enumerated.item]);
 
 	return 0;
 }
 
-static int tas5805m_crossover_get(struct snd_kcontrol *kcontrol,
-				  struct snd_ctl_elem_value *ucontrol)
+static int tas5805m_crossover_slope_get(struct snd_kcontrol *kcontrol,
+					struct snd_ctl_elem_value *ucontrol)
 {
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	unsigned int slope[TAS5805M_CHANNELS];
 
-	ucontrol->value.enumerated.item[0] = tas5805m->crossover_freq;
+	tas5805m_get_member(tas5805m, crossover_slope, slope);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		ucontrol->value.enumerated.item[ch] = slope[ch];
 
 	return 0;
 }
 
-static int tas5805m_crossover_put(struct snd_kcontrol *kcontrol,
-				  struct snd_ctl_elem_value *ucontrol)
+static int tas5805m_crossover_slope_put(struct snd_kcontrol *kcontrol,
+					struct snd_ctl_elem_value *ucontrol)
 {
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
-	unsigned int val = ucontrol->value.enumerated.item[0];
+	unsigned int *val = ucontrol->value.enumerated.item;
 	int ret = 0;
 
-	if (val >= ARRAY_SIZE(crossover_freq_text))
-		return -EINVAL;
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		if (val[ch] >= ARRAY_SIZE(crossover_slope_text))
+			return -EINVAL;
 
-	mutex_lock(&tas5805m->lock);
-	if (tas5805m->crossover_freq != val) {
-		tas5805m->crossover_freq = val;
-		dev_dbg(component->dev, "%s: set crossover=%s (is_powered=%d)\n",
-				__func__, crossover_freq_text[val], tas5805m->is_powered);
-		if (tas5805m->is_powered)
-			tas5805m_refresh(tas5805m);
-		else
-			dev_dbg(component->dev, "%s: Crossover change deferred until power-up\n",
-					__func__);
-		ret = 1;
+	write_seqlock(&tas5805m->state_lock);
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		if (tas5805m->state.crossover_slope[ch] != val[ch]) {
+			tas5805m->state.crossover_slope[ch] = val[ch];
+			ret = 1;
+		}
+	}
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set crossover slope=%s,%s\n", __func__,
+				crossover_slope_text[val[0]], crossover_slope_text[val[1]]);
+		tas5805m_commit(tas5805m);
 	}
-	mutex_unlock(&tas5805m->lock);
 
 	return ret;
 }
@@ -865,8 +3145,10 @@ static int tas5805m_mixer_mode_get(struct snd_kcontrol *kcontrol,
 {
 	struct snd_soc_component *component = snd_soc_kcontrol_component(kcontrol);
 	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	unsigned int mixer_mode;
 
-	ucontrol->value.enumerated.item[0] = tas5805m->mixer_mode;
+	tas5805m_get_member(tas5805m, mixer_mode, &mixer_mode);
+	ucontrol->value.enumerated.item[0] = mixer_mode;
 
 	return 0;
 }
@@ -882,48 +3164,46 @@ static int tas5805m_mixer_mode_put(struct snd_kcontrol *kcontrol,
 	if (val >= ARRAY_SIZE(mixer_mode_text))
 		return -EINVAL;
 
-	mutex_lock(&tas5805m->lock);
-	if (tas5805m->mixer_mode != val) {
-		tas5805m->mixer_mode = val;
+	write_seqlock(&tas5805m->state_lock);
+	if (tas5805m->state.mixer_mode != val) {
+		tas5805m->state.mixer_mode = val;
 		
 		/* Apply preset mixer values based on mode */
 		switch (val) {
 		case 0: /* Stereo */
-			tas5805m->mixer_l2l = TAS5805M_MIXER_MAX_DB;   /* 0dB */
-			tas5805m->mixer_r2l = TAS5805M_MIXER_MIN_DB; /* Mute */
-			tas5805m->mixer_l2r = TAS5805M_MIXER_MIN_DB; /* Mute */
-			tas5805m->mixer_r2r = TAS5805M_MIXER_MAX_DB;   /* 0dB */
+			tas5805m->state.mixer_l2l = TAS5805M_MIXER_MAX_DB;   /* 0dB */
+			tas5805m->state.mixer_r2l = TAS5805M_MIXER_MIN_DB; /* Mute */
+			tas5805m->state.mixer_l2r = TAS5805M_MIXER_MIN_DB; /* Mute */
+			tas5805m->state.mixer_r2r = TAS5805M_MIXER_MAX_DB;   /* 0dB */
 			break;
 		case 1: /* Mono */
-			tas5805m->mixer_l2l = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
-			tas5805m->mixer_r2l = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
-			tas5805m->mixer_l2r = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
-			tas5805m->mixer_r2r = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
+			tas5805m->state.mixer_l2l = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
+			tas5805m->state.mixer_r2l = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
+			tas5805m->state.mixer_l2r = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
+			tas5805m->state.mixer_r2r = TAS5805M_MIXER_HALFMAX_DB;  /* -6dB */
 			break;
 		case 2: /* Left */
-			tas5805m->mixer_l2l = TAS5805M_MIXER_MAX_DB;   /* 0dB */
-			tas5805m->mixer_r2l = TAS5805M_MIXER_MIN_DB; /* Mute */
-			tas5805m->mixer_l2r = TAS5805M_MIXER_MAX_DB;   /* 0dB */
-			tas5805m->mixer_r2r = TAS5805M_MIXER_MIN_DB; /* Mute */
+			tas5805m->state.mixer_l2l = TAS5805M_MIXER_MAX_DB;   /* 0dB */
+			tas5805m->state.mixer_r2l = TAS5805M_MIXER_MIN_DB; /* Mute */
+			tas5805m->state.mixer_l2r = TAS5805M_MIXER_MAX_DB;   /* 0dB */
+			tas5805m->state.mixer_r2r = TAS5805M_MIXER_MIN_DB; /* Mute */
 			break;
 		case 3: /* Right */
-			tas5805m->mixer_l2l = TAS5805M_MIXER_MIN_DB; /* Mute */
-			tas5805m->mixer_r2l = TAS5805M_MIXER_MAX_DB;   /* 0dB */
-			tas5805m->mixer_l2r = TAS5805M_MIXER_MIN_DB; /* Mute */
-			tas5805m->mixer_r2r = TAS5805M_MIXER_MAX_DB;   /* 0dB */
+			tas5805m->state.mixer_l2l = TAS5805M_MIXER_MIN_DB; /* Mute */
+			tas5805m->state.mixer_r2l = TAS5805M_MIXER_MAX_DB;   /* 0dB */
+			tas5805m->state.mixer_l2r = TAS5805M_MIXER_MIN_DB; /* Mute */
+			tas5805m->state.mixer_r2r = TAS5805M_MIXER_MAX_DB;   /* 0dB */
 			break;
 		}
-		
-		dev_dbg(component->dev, "%s: set mixer_mode=%s (is_powered=%d)\n",
-				__func__, mixer_mode_text[val], tas5805m->is_powered);
-		if (tas5805m->is_powered)
-			tas5805m_refresh(tas5805m);
-		else
-			dev_dbg(component->dev, "%s: Mixer mode change deferred until power-up\n",
-					__func__);
 		ret = 1;
 	}
-	mutex_unlock(&tas5805m->lock);
+	write_sequnlock(&tas5805m->state_lock);
+
+	if (ret) {
+		dev_dbg(component->dev, "%s: set mixer_mode=%s\n",
+				__func__, mixer_mode_text[val]);
+		tas5805m_commit(tas5805m);
+	}
 
 	return ret;
 }
@@ -938,7 +3218,14 @@ static const struct snd_kcontrol_new tas5805m_snd_controls_base[] = {
 		.info	= tas5805m_vol_info,
 		.get	= tas5805m_vol_get,
 		.put	= tas5805m_vol_put,
+		.tlv.p	= tas5805m_vol_tlv,
 	},
+	/* No dB TLV: the value attenuates the opposite channel rather than
+	 * being a gain, which Digital Volume carries per channel
+	 */
+	TAS5805M_PARAM("Balance", balance,
+		       -TAS5805M_BALANCE_MAX, TAS5805M_BALANCE_MAX),
+	TAS5805M_ENUM("Volume Ramp", vol_ramp_ctrl),
 	{
 		.iface	= SNDRV_CTL_ELEM_IFACE_MIXER,
 		.name	= "Analog Gain",
@@ -987,6 +3274,52 @@ static const struct snd_kcontrol_new tas5805m_snd_controls_eq_15band[] = {
 	TAS5805M_EQ_BAND("05000 Hz", 12),
 	TAS5805M_EQ_BAND("08000 Hz", 13),
 	TAS5805M_EQ_BAND("16000 Hz", 14),
+	SND_SOC_BYTES_EXT("EQ Batch", sizeof(struct tas5805m_eq_batch),
+			  tas5805m_eq_batch_get, tas5805m_eq_batch_put),
+	TAS5805M_PARAM("Loudness Switch", loudness, 0, 1),
+};
+
+/* DRC, AGL, soft clipper, thermal foldback and auto standby controls
+ * (always registered)
+ */
+static const struct snd_kcontrol_new tas5805m_snd_controls_dynamics[] = {
+	TAS5805M_PARAM("DRC Switch", drc.enable, 0, 1),
+	TAS5805M_PARAM_TLV("DRC Threshold", drc.threshold,
+			   TAS5805M_DRC_THRESHOLD_MIN_DB, 0, tas5805m_drc_threshold_tlv),
+	TAS5805M_PARAM("DRC Ratio", drc.ratio, 1, TAS5805M_DRC_RATIO_MAX),
+	TAS5805M_PARAM("DRC Attack Time", drc.attack,
+		       TAS5805M_DYN_ATTACK_MIN_MS, TAS5805M_DYN_ATTACK_MAX_MS),
+	TAS5805M_PARAM("DRC Release Time", drc.release,
+		       TAS5805M_DYN_RELEASE_MIN_MS, TAS5805M_DYN_RELEASE_MAX_MS),
+	TAS5805M_PARAM("AGL Switch", agl.enable, 0, 1),
+	TAS5805M_PARAM_TLV("AGL Threshold", agl.threshold,
+			   TAS5805M_AGL_THRESHOLD_MIN_DB, 0, tas5805m_agl_threshold_tlv),
+	TAS5805M_PARAM("AGL Attack Time", agl.attack,
+		       TAS5805M_DYN_ATTACK_MIN_MS, TAS5805M_DYN_ATTACK_MAX_MS),
+	TAS5805M_PARAM("AGL Release Time", agl.release,
+		       TAS5805M_DYN_RELEASE_MIN_MS, TAS5805M_DYN_RELEASE_MAX_MS),
+	TAS5805M_PARAM("Soft Clipper Switch", clip_enable, 0, 1),
+	TAS5805M_PARAM_TLV("Soft Clipper Threshold", clip_threshold,
+			   TAS5805M_CLIP_THRESHOLD_MIN_DB, 0, tas5805m_clip_threshold_tlv),
+	TAS5805M_PARAM_TLV("Soft Clipper Knee", clip_knee,
+			   0, TAS5805M_CLIP_KNEE_MAX_DB, tas5805m_clip_knee_tlv),
+	TAS5805M_PARAM("Thermal Foldback Switch", thermal.enable, 0, 1),
+	TAS5805M_PARAM_TLV("Thermal Foldback Step", thermal.step,
+			   1, TAS5805M_THERMAL_STEP_MAX_DB, tas5805m_thermal_tlv),
+	TAS5805M_PARAM_TLV("Thermal Foldback Limit", thermal.limit,
+			   1, TAS5805M_THERMAL_LIMIT_MAX_DB, tas5805m_thermal_tlv),
+	TAS5805M_PARAM("Thermal Foldback Interval", thermal.interval,
+		       TAS5805M_THERMAL_INTERVAL_MIN_MS, TAS5805M_THERMAL_INTERVAL_MAX_MS),
+	TAS5805M_PARAM("Thermal Foldback Hold Time", thermal.hold, 0, TAS5805M_THERMAL_HOLD_MAX_MS),
+	TAS5805M_PARAM("Auto Standby Switch", standby.enable, 0, 1),
+	TAS5805M_PARAM("Auto Standby Timeout", standby.timeout, 1, TAS5805M_STANDBY_TIMEOUT_MAX_S),
+	TAS5805M_PARAM("Auto Standby Poll Interval", standby.poll,
+		       TAS5805M_STANDBY_POLL_MIN_MS, TAS5805M_STANDBY_POLL_MAX_MS),
+};
+
+/* Room correction controls (registered when ti,room-correction-name loaded) */
+static const struct snd_kcontrol_new tas5805m_snd_controls_rc[] = {
+	TAS5805M_PARAM("Room Correction Switch", room_correction, 0, 1),
 };
 
 /* Crossover controls (registered when EQ mode is crossover) */
@@ -995,13 +3328,21 @@ static const struct snd_kcontrol_new tas5805m_snd_controls_crossover[] = {
 		.iface	= SNDRV_CTL_ELEM_IFACE_MIXER,
 		.name	= "Crossover Frequency",
 		.access	= SNDRV_CTL_ELEM_ACCESS_READWRITE,
-		.info	= tas5805m_crossover_info,
-		.get	= tas5805m_crossover_get,
-		.put	= tas5805m_crossover_put,
+		.info	= tas5805m_crossover_freq_info,
+		.get	= tas5805m_crossover_freq_get,
+		.put	= tas5805m_crossover_freq_put,
+	},
+	{
+		.iface	= SNDRV_CTL_ELEM_IFACE_MIXER,
+		.name	= "Crossover Slope",
+		.access	= SNDRV_CTL_ELEM_ACCESS_READWRITE,
+		.info	= tas5805m_crossover_slope_info,
+		.get	= tas5805m_crossover_slope_get,
+		.put	= tas5805m_crossover_slope_put,
 	},
 };
 
-static void send_cfg(struct regmap *rm,
+static void send_cfg(struct tas5805m_priv *tas5805m,
 		     const uint8_t *s, unsigned int len)
 {
 	unsigned int i;
@@ -1009,7 +3350,7 @@ static void send_cfg(struct regmap *rm,
 	pr_debug("%s: len=%u\n", 
 		__func__, len);
 	for (i = 0; i + 1 < len; i += 2)
-		regmap_write(rm, s[i], s[i + 1]);
+		tas5805m_write(tas5805m, s[i], s[i + 1]);
 }
 
 /* The TAS5805M DSP can't be configured until the I2S clock has been
@@ -1020,10 +3361,11 @@ static int tas5805m_trigger(struct snd_pcm_substream *substream, int cmd,
 			    struct snd_soc_dai *dai)
 {
 	struct snd_soc_component *component = dai->component;
-	struct tas5805m_priv *priv;
+	struct tas5805m_priv *priv = snd_soc_component_get_drvdata(component);
 
 	dev_dbg(component->dev, "%s: cmd=%d\n", 
 		__func__, cmd);
+	trace_tas5805m_trigger(priv->i2c->addr, cmd);
 
 	switch (cmd) {
 	case SNDRV_PCM_TRIGGER_START:
@@ -1064,12 +3406,13 @@ static void do_work(struct work_struct *work)
 {
 	struct tas5805m_priv *tas5805m =
 	       container_of(work, struct tas5805m_priv, work);
-	struct regmap *rm = tas5805m->regmap;
+	ktime_t work_start = ktime_get();
 
 	dev_dbg(&tas5805m->i2c->dev, "%s: DSP startup\n", 
 		__func__);
 
 	mutex_lock(&tas5805m->lock);
+	trace_tas5805m_work_start(tas5805m->i2c->addr, tas5805m->dsp_initialized);
 	/* We mustn't issue any I2C transactions until the I2S
 	 * clock is stable. Furthermore, we must allow a 5ms
 	 * delay after the first set of register writes to
@@ -1079,27 +3422,41 @@ static void do_work(struct work_struct *work)
 	
 	/* Only send preboot config once per PDN cycle */
 	if (!tas5805m->dsp_initialized) {
+		ktime_t boot_start = ktime_get();
+
 		dev_dbg(&tas5805m->i2c->dev, "%s: sending preboot config\n", __func__);
-		send_cfg(rm, dsp_cfg_preboot, ARRAY_SIZE(dsp_cfg_preboot));
+		/* The DSP reset clears the coefficient memory */
+		tas5805m->bq_valid = 0;
+		tas5805m->blk_valid = 0;
+		send_cfg(tas5805m, dsp_cfg_preboot, ARRAY_SIZE(dsp_cfg_preboot));
 		// Need to wait until clock is read by the DAC
 		usleep_range(5000, 10000);
+		trace_tas5805m_preboot(tas5805m->i2c->addr,
+				       ktime_us_delta(ktime_get(), boot_start));
 		if (tas5805m->dsp_cfg_len > 0)
 		{
-			send_cfg(rm, tas5805m->dsp_cfg_data, tas5805m->dsp_cfg_len);
+			ktime_t fw_start = ktime_get();
+			s64 fw_us;
+
+			send_cfg(tas5805m, tas5805m->dsp_cfg_data, tas5805m->dsp_cfg_len);
+			fw_us = tas5805m_time_op(tas5805m, TAS5805M_OP_FW_UPLOAD, fw_start);
+			trace_tas5805m_fw_upload(tas5805m->i2c->addr,
+						 tas5805m->dsp_cfg_len, fw_us);
 		}
 		
 		/* Apply bridge mode setting from device tree after DSP boot */
-		SET_BOOK_AND_PAGE(rm, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
+		tas5805m_select_page(tas5805m, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0);
 		unsigned int dctrl1_init = (tas5805m->modulation_mode & 0x3) |
 								  ((tas5805m->bridge_mode & 0x1) << 2) |
 								  ((tas5805m->switch_freq & 0x7) << 4);
-		regmap_write(rm, TAS5805M_REG_DEVICE_CTRL_1, dctrl1_init);
+		tas5805m_write(tas5805m, TAS5805M_REG_DEVICE_CTRL_1, dctrl1_init);
 		dev_info(&tas5805m->i2c->dev, "%s: Device configuration: modulation=%u, bridge_mode=%u (%s), switch_freq=%u\n",
 				 __func__, tas5805m->modulation_mode, tas5805m->bridge_mode,
 				 tas5805m->bridge_mode ? "Bridge/PBTL" : "Normal/Stereo",
 				 tas5805m->switch_freq);
 		
 		tas5805m->dsp_initialized = true;
+		tas5805m_time_op(tas5805m, TAS5805M_OP_DSP_BOOT, boot_start);
 	} else {
 		dev_dbg(&tas5805m->i2c->dev, "%s: DSP already initialized, skipping preboot config\n", __func__);
 	}
@@ -1109,6 +3466,9 @@ static void do_work(struct work_struct *work)
 	
 	/* Mark as powered only after successful initialization and refresh */
 	tas5805m->is_powered = true;
+	tas5805m_set_power_state(tas5805m, TAS5805M_POWER_PLAY);
+	trace_tas5805m_work_end(tas5805m->i2c->addr,
+				ktime_us_delta(ktime_get(), work_start));
 	mutex_unlock(&tas5805m->lock);
 }
 
@@ -1118,10 +3478,10 @@ static int tas5805m_dac_event(struct snd_soc_dapm_widget *w,
 	struct snd_soc_component *component = snd_soc_dapm_to_component(w->dapm);
 	struct tas5805m_priv *tas5805m =
 		snd_soc_component_get_drvdata(component);
-	struct regmap *rm = tas5805m->regmap;
 
 	dev_dbg(component->dev, "%s: event=0x%x\n", 
 		__func__, event);
+	trace_tas5805m_dapm(tas5805m->i2c->addr, event, READ_ONCE(tas5805m->is_powered));
 
 	if (event & SND_SOC_DAPM_POST_PMU) {
 		dev_dbg(component->dev, "%s: DSP power-up\n", __func__);
@@ -1131,13 +3491,30 @@ static int tas5805m_dac_event(struct snd_soc_dapm_widget *w,
 	if (event & SND_SOC_DAPM_PRE_PMD) {
 		dev_dbg(component->dev, "%s: DSP shutdown\n", __func__);
 		cancel_work_sync(&tas5805m->work);
+		cancel_delayed_work_sync(&tas5805m->fault_work);
+		cancel_delayed_work_sync(&tas5805m->thermal_work);
+		cancel_delayed_work_sync(&tas5805m->standby_work);
 
 		mutex_lock(&tas5805m->lock);
+		/* The next stream start tries channels muted by a fault again */
+		tas5805m->fault_muted = 0;
+		tas5805m->silent = false;
 		if (tas5805m->is_powered) {
+			s64 ramp_us = ktime_us_delta(tas5805m->ramp_end, ktime_get());
+
+			/* Let a soft mute ramp finish, cutting it short clicks */
+			if (tas5805m->soft_muted && ramp_us > 0) {
+				dev_dbg(component->dev, "%s: waiting %lld us for the mute ramp\n",
+					__func__, ramp_us);
+				usleep_range(ramp_us, ramp_us + 1000);
+			}
+
 			tas5805m->is_powered = false;
+			tas5805m->soft_muted = false;
+			tas5805m_set_power_state(tas5805m, TAS5805M_POWER_SLEEP);
 			dev_dbg(component->dev, "%s: writing device state 0x%02x\n",
 				__func__, TAS5805M_DCTRL2_MODE_DEEP_SLEEP);
-			regmap_write(rm, TAS5805M_REG_DEVICE_CTRL_2, TAS5805M_DCTRL2_MODE_DEEP_SLEEP);
+			tas5805m_write(tas5805m, TAS5805M_REG_DEVICE_CTRL_2, TAS5805M_DCTRL2_MODE_DEEP_SLEEP);
 		}
 		mutex_unlock(&tas5805m->lock);
 	}
@@ -1164,24 +3541,219 @@ static int tas5805m_mute(struct snd_soc_dai *dai, int mute, int direction)
 	struct snd_soc_component *component = dai->component;
 	struct tas5805m_priv *tas5805m =
 		snd_soc_component_get_drvdata(component);
-		
-	mutex_lock(&tas5805m->lock);
 
-	dev_dbg(component->dev, "%s: mute=%d, direction=%d, is_powered=%d\n", 
-		__func__, mute, direction, tas5805m->is_powered);
+	dev_dbg(component->dev, "%s: mute=%d, direction=%d\n", 
+		__func__, mute, direction);
 
-	tas5805m->is_muted = mute;
-	if (tas5805m->is_powered)
-		tas5805m_refresh(tas5805m);
-	else
-		dev_dbg(component->dev, "%s: mute change deferred until power-up\n", 
+	write_seqlock(&tas5805m->state_lock);
+	tas5805m->state.is_muted = mute;
+	write_sequnlock(&tas5805m->state_lock);
+
+	tas5805m_commit(tas5805m);
+
+	return 0;
+}
+
+/* The serial port settings only reach the primary codec DAI, while every
+ * amp on the bus receives the same stream. Copy them to all devices, like
+ * the trigger, and refresh those where something changed.
+ * Caller holds tas5805m_list_mutex.
+ */
+static void tas5805m_set_port(const struct tas5805m_port *port)
+{
+	struct tas5805m_priv *priv;
+
+	list_for_each_entry(priv, &tas5805m_device_list, list) {
+		bool changed;
+
+		write_seqlock(&priv->state_lock);
+		changed = memcmp(&priv->state.port, port, sizeof(*port));
+		priv->state.port = *port;
+		write_sequnlock(&priv->state_lock);
+
+		if (changed) {
+			dev_dbg(&priv->i2c->dev, "%s: rate=%u, width=%u, format=0x%02x, tdm %ux%u slot %u\n",
+				__func__, port->rate, port->width, port->format,
+				port->tdm_slots, port->tdm_width, priv->state.tdm_slot);
+			tas5805m_commit(priv);
+		}
+	}
+}
+
+static int tas5805m_hw_params(struct snd_pcm_substream *substream,
+			      struct snd_pcm_hw_params *params,
+			      struct snd_soc_dai *dai)
+{
+	struct snd_soc_component *component = dai->component;
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	unsigned int channels = params_channels(params);
+	struct tas5805m_port port;
+	int ret = 0;
+
+	dev_dbg(component->dev, "%s: rate=%u, width=%d, channels=%u\n", __func__,
+		params_rate(params), params_width(params), channels);
+
+	/* Samples are MSB first, the word length tells the amp how many bits
+	 * of each slot to take. S24_LE and S24_3LE both carry 24 bits.
+	 */
+	if (tas5805m_word_length(params_width(params)) < 0) {
+		dev_err(component->dev, "%s: unsupported width %d\n",
+			__func__, params_width(params));
+		return -EINVAL;
+	}
+
+	mutex_lock(&tas5805m_list_mutex);
+	port = tas5805m->state.port;
+	if (channels > max(port.tdm_slots, 2U)) {
+		dev_err(component->dev, "%s: %u channels need as many TDM slots\n",
+			__func__, channels);
+		ret = -EINVAL;
+	} else {
+		port.rate = params_rate(params);
+		port.width = params_width(params);
+		tas5805m_set_port(&port);
+	}
+	mutex_unlock(&tas5805m_list_mutex);
+
+	return ret;
+}
+
+static int tas5805m_set_fmt(struct snd_soc_dai *dai, unsigned int fmt)
+{
+	struct snd_soc_component *component = dai->component;
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	unsigned int format, delay = 0;
+	struct tas5805m_port port;
+
+	dev_dbg(component->dev, "%s: fmt=0x%04x\n", __func__, fmt);
+
+	if ((fmt & SND_SOC_DAIFMT_CLOCK_PROVIDER_MASK) != SND_SOC_DAIFMT_CBC_CFC) {
+		dev_err(component->dev, "%s: amp must be clock consumer\n",
 			__func__);
-	mutex_unlock(&tas5805m->lock);
+		return -EINVAL;
+	}
+
+	if ((fmt & SND_SOC_DAIFMT_INV_MASK) != SND_SOC_DAIFMT_NB_NF) {
+		dev_err(component->dev, "%s: inverted clocks not supported\n",
+			__func__);
+		return -EINVAL;
+	}
+
+	/* In TDM mode the amp takes the first bit on the frame sync edge,
+	 * DSP_A data comes one SCLK later.
+	 */
+	switch (fmt & SND_SOC_DAIFMT_FORMAT_MASK) {
+	case SND_SOC_DAIFMT_I2S:
+		format = TAS5805M_SAP_FMT_I2S;
+		break;
+	case SND_SOC_DAIFMT_RIGHT_J:
+		format = TAS5805M_SAP_FMT_RTJ;
+		break;
+	case SND_SOC_DAIFMT_LEFT_J:
+		format = TAS5805M_SAP_FMT_LTJ;
+		break;
+	case SND_SOC_DAIFMT_DSP_A:
+		format = TAS5805M_SAP_FMT_TDM;
+		delay = 1;
+		break;
+	case SND_SOC_DAIFMT_DSP_B:
+		format = TAS5805M_SAP_FMT_TDM;
+		break;
+	default:
+		dev_err(component->dev, "%s: unsupported format 0x%x\n",
+			__func__, fmt & SND_SOC_DAIFMT_FORMAT_MASK);
+		return -EINVAL;
+	}
+
+	mutex_lock(&tas5805m_list_mutex);
+	port = tas5805m->state.port;
+	port.format = format;
+	port.delay = delay;
+	tas5805m_set_port(&port);
+	mutex_unlock(&tas5805m_list_mutex);
 
 	return 0;
 }
 
+/* Each amp plays two adjacent slots of the TDM frame. Only the primary
+ * codec DAI gets its slot from the mask, amps on the bus as aux devices
+ * take theirs from the ti,tdm-slot property. slots = 0 leaves TDM mode.
+ */
+static int tas5805m_set_tdm_slot(struct snd_soc_dai *dai, unsigned int tx_mask,
+				 unsigned int rx_mask, int slots, int slot_width)
+{
+	struct snd_soc_component *component = dai->component;
+	struct tas5805m_priv *tas5805m = snd_soc_component_get_drvdata(component);
+	struct tas5805m_port port;
+	struct tas5805m_priv *priv;
+	unsigned int slot = 0;
+	bool set_slot = false;
+	int ret = 0;
+
+	dev_dbg(component->dev, "%s: tx_mask=0x%x, slots=%d, width=%d\n",
+		__func__, tx_mask, slots, slot_width);
+
+	if (slots) {
+		if (slots < 2 || tas5805m_word_length(slot_width) < 0 ||
+		    (slots - 1) * slot_width + 1 > TAS5805M_SAP_OFFSET_MAX) {
+			dev_err(component->dev, "%s: unsupported frame %dx%d\n",
+				__func__, slots, slot_width);
+			return -EINVAL;
+		}
+
+		/* Without a mask from the card the core enables every slot */
+		if (tx_mask && tx_mask != GENMASK(slots - 1, 0) &&
+		    !tas5805m->tdm_slot_from_dt) {
+			unsigned int first = __ffs(tx_mask);
+
+			if (tx_mask >> first > 3) {
+				dev_err(component->dev, "%s: slots in 0x%x are not adjacent\n",
+					__func__, tx_mask);
+				return -EINVAL;
+			}
+			slot = first;
+			set_slot = true;
+		}
+	}
+
+	/* Check every amp against the new frame before changing anything.
+	 * The slots only change under the list lock.
+	 */
+	mutex_lock(&tas5805m_list_mutex);
+	list_for_each_entry(priv, &tas5805m_device_list, list) {
+		unsigned int s = priv == tas5805m && set_slot ? slot : priv->state.tdm_slot;
+
+		if (slots && s >= slots) {
+			dev_err(&priv->i2c->dev, "%s: slot %u outside the %d slot frame\n",
+				__func__, s, slots);
+			ret = -EINVAL;
+		}
+	}
+	if (!ret) {
+		if (set_slot) {
+			write_seqlock(&tas5805m->state_lock);
+			tas5805m->state.tdm_slot = slot;
+			write_sequnlock(&tas5805m->state_lock);
+		}
+
+		port = tas5805m->state.port;
+		port.tdm_slots = slots;
+		port.tdm_width = slots ? slot_width : 0;
+		tas5805m_set_port(&port);
+
+		/* A new slot alone leaves the port as it was */
+		if (set_slot)
+			tas5805m_commit(tas5805m);
+	}
+	mutex_unlock(&tas5805m_list_mutex);
+
+	return ret;
+}
+
 static const struct snd_soc_dai_ops tas5805m_dai_ops = {
+	.hw_params		= tas5805m_hw_params,
+	.set_fmt		= tas5805m_set_fmt,
+	.set_tdm_slot		= tas5805m_set_tdm_slot,
 	.trigger		    = tas5805m_trigger,
 	.mute_stream		= tas5805m_mute,
 	.no_capture_mute	= 1,
@@ -1192,13 +3764,296 @@ static struct snd_soc_dai_driver tas5805m_dai = {
 	.playback	= {
 		.stream_name	= "Playback",
 		.channels_min	= 2,
-		.channels_max	= 2,
-		.rates		= SNDRV_PCM_RATE_48000,
-		.formats	= SNDRV_PCM_FMTBIT_S32_LE,
+		.channels_max	= TAS5805M_TDM_SLOTS_MAX,
+		.rates		= SNDRV_PCM_RATE_44100 | SNDRV_PCM_RATE_48000 |
+				  SNDRV_PCM_RATE_88200 | SNDRV_PCM_RATE_96000,
+		.formats	= SNDRV_PCM_FMTBIT_S16_LE | SNDRV_PCM_FMTBIT_S24_LE |
+				  SNDRV_PCM_FMTBIT_S24_3LE | SNDRV_PCM_FMTBIT_S32_LE,
 	},
 	.ops		= &tas5805m_dai_ops,
 };
 
+static int tas5805m_stats_show(struct seq_file *m, void *unused)
+{
+	struct tas5805m_priv *tas5805m = m->private;
+	struct tas5805m_stats stats;
+	enum tas5805m_power power_state;
+	unsigned int thermal_att;
+	u8 fault_muted;
+	int op, bucket;
+
+	mutex_lock(&tas5805m->lock);
+	stats = tas5805m->stats;
+	fault_muted = tas5805m->fault_muted;
+	thermal_att = tas5805m->thermal_att;
+	power_state = tas5805m->power_state;
+	/* Count the current state up to now */
+	stats.power_us[power_state] += ktime_us_delta(ktime_get(), tas5805m->power_since);
+	mutex_unlock(&tas5805m->lock);
+
+	seq_printf(m, "writes:        %llu\n", stats.writes);
+	seq_printf(m, "bulk_writes:   %llu\n", stats.bulk_writes);
+	seq_printf(m, "reads:         %llu\n", stats.reads);
+	seq_printf(m, "bytes:         %llu\n", stats.bytes);
+	seq_printf(m, "page_switches: %llu\n", stats.page_switches);
+	seq_printf(m, "errors:        %llu\n", stats.errors);
+	seq_printf(m, "bus_time_us:   %llu\n", div_u64(stats.bus_ns, 1000));
+
+	seq_puts(m, "\nfault recovery:\n");
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		seq_printf(m, "%-6s faults %u, retries %u, recovered %u, given up %u%s\n",
+			   ch ? "right:" : "left:", stats.chan_faults[ch],
+			   stats.fault_retries[ch], stats.fault_recoveries[ch],
+			   stats.fault_give_ups[ch], fault_muted & BIT(ch) ? ", muted" : "");
+	seq_printf(m, "global faults: %u\n", stats.global_faults);
+	seq_printf(m, "recovery_us:   %llu last, %llu max\n",
+		   stats.recovery_us_last, stats.recovery_us_max);
+
+	seq_printf(m, "\nthermal foldback: -%u.%u dB now, -%u.%u dB deepest\n",
+		   thermal_att / 2, 5 * (thermal_att % 2),
+		   stats.thermal_att_max / 2, 5 * (stats.thermal_att_max % 2));
+	seq_printf(m, "warnings %u, steps %u, folded back %llu ms\n",
+		   stats.thermal_warnings, stats.thermal_steps, div_u64(stats.thermal_us, 1000));
+
+	seq_puts(m, "\npower state residency:\n");
+	for (int ps = 0; ps < TAS5805M_POWER_COUNT; ps++)
+		seq_printf(m, "%-11s %llu ms, entries %u%s\n",
+			   tas5805m_power_names[ps], div_u64(stats.power_us[ps], 1000),
+			   stats.power_entries[ps], ps == power_state ? ", now" : "");
+
+	seq_puts(m, "\nlatency histogram, bucket n counts [2^(n-1), 2^n) us:\n");
+	seq_printf(m, "%-10s", "op");
+	for (bucket = 0; bucket < TAS5805M_HIST_BUCKETS; bucket++)
+		seq_printf(m, " %6d", bucket);
+	seq_putc(m, '\n');
+
+	for (op = 0; op < TAS5805M_OP_COUNT; op++) {
+		seq_printf(m, "%-10s", tas5805m_op_text[op]);
+		for (bucket = 0; bucket < TAS5805M_HIST_BUCKETS; bucket++)
+			seq_printf(m, " %6u", stats.hist[op][bucket]);
+		seq_putc(m, '\n');
+	}
+
+	return 0;
+}
+
+static int tas5805m_stats_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, tas5805m_stats_show, inode->i_private);
+}
+
+/* Any write clears the counters */
+static ssize_t tas5805m_stats_write(struct file *file, const char __user *buf,
+				    size_t count, loff_t *ppos)
+{
+	struct seq_file *m = file->private_data;
+	struct tas5805m_priv *tas5805m = m->private;
+
+	mutex_lock(&tas5805m->lock);
+	memset(&tas5805m->stats, 0, sizeof(tas5805m->stats));
+	tas5805m->power_since = ktime_get();
+	mutex_unlock(&tas5805m->lock);
+
+	return count;
+}
+
+static const struct file_operations tas5805m_stats_fops = {
+	.owner		= THIS_MODULE,
+	.open		= tas5805m_stats_open,
+	.read		= seq_read,
+	.write		= tas5805m_stats_write,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
+/* Biquad use per channel as of the last refresh: the EQ band or
+ * crossover section in each slot, the active bands that did not fit, and
+ * the room correction filters placed and left out
+ */
+static int tas5805m_biquads_show(struct seq_file *m, void *unused)
+{
+	struct tas5805m_priv *tas5805m = m->private;
+	s8 map[TAS5805M_CHANNELS][TAS5805M_EQ_BANDS];
+	u32 dropped[TAS5805M_CHANNELS];
+	u8 rc_applied[TAS5805M_CHANNELS], rc_dropped[TAS5805M_CHANNELS];
+	int ch, i;
+
+	mutex_lock(&tas5805m->lock);
+	memcpy(map, tas5805m->bq_map, sizeof(map));
+	memcpy(dropped, tas5805m->bq_dropped, sizeof(dropped));
+	memcpy(rc_applied, tas5805m->rc_applied, sizeof(rc_applied));
+	memcpy(rc_dropped, tas5805m->rc_dropped, sizeof(rc_dropped));
+	mutex_unlock(&tas5805m->lock);
+
+	for (ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		seq_printf(m, "%-6s", ch ? "right:" : "left:");
+		for (i = 0; i < TAS5805M_EQ_BANDS; i++) {
+			if (map[ch][i] >= TAS5805M_BQ_MAP_LOUD(0))
+				seq_printf(m, " ld%d", map[ch][i] - TAS5805M_BQ_MAP_LOUD(0));
+			else if (map[ch][i] >= TAS5805M_BQ_MAP_RC(0))
+				seq_printf(m, " r%02d", map[ch][i] - TAS5805M_BQ_MAP_RC(0));
+			else if (map[ch][i] >= TAS5805M_BQ_MAP_XO(0))
+				seq_printf(m, " xo%d", map[ch][i] - TAS5805M_BQ_MAP_XO(0));
+			else
+				seq_printf(m, " %3d", map[ch][i]);
+		}
+		seq_printf(m, "  dropped 0x%04x  rc %u/%u\n", dropped[ch],
+			   rc_applied[ch], rc_applied[ch] + rc_dropped[ch]);
+	}
+
+	return 0;
+}
+
+static int tas5805m_biquads_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, tas5805m_biquads_show, inode->i_private);
+}
+
+static const struct file_operations tas5805m_biquads_fops = {
+	.owner		= THIS_MODULE,
+	.open		= tas5805m_biquads_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
+static ssize_t tas5805m_record_enable_read(struct file *file, char __user *buf,
+					   size_t count, loff_t *ppos)
+{
+	struct tas5805m_priv *tas5805m = file->private_data;
+	char val[2] = { READ_ONCE(tas5805m->rec.enabled) ? '1' : '0', '\n' };
+
+	return simple_read_from_buffer(buf, count, ppos, val, sizeof(val));
+}
+
+/* Writing 1 starts a new capture, 0 stops it and keeps the data for dumping */
+static ssize_t tas5805m_record_enable_write(struct file *file, const char __user *buf,
+					    size_t count, loff_t *ppos)
+{
+	struct tas5805m_priv *tas5805m = file->private_data;
+	struct tas5805m_rec_entry *new_buf = NULL;
+	bool enable;
+	int ret;
+
+	ret = kstrtobool_from_user(buf, count, &enable);
+	if (ret)
+		return ret;
+
+	if (enable && !tas5805m->rec.buf) {
+		new_buf = vmalloc(array_size(TAS5805M_REC_ENTRIES, sizeof(*new_buf)));
+		if (!new_buf)
+			return -ENOMEM;
+	}
+
+	mutex_lock(&tas5805m->lock);
+	if (new_buf) {
+		if (tas5805m->rec.buf)
+			vfree(new_buf);
+		else
+			tas5805m->rec.buf = new_buf;
+	}
+	if (enable) {
+		tas5805m->rec.count = 0;
+		tas5805m->rec.start = ktime_get();
+	}
+	tas5805m->rec.enabled = enable;
+	mutex_unlock(&tas5805m->lock);
+
+	return count;
+}
+
+static const struct file_operations tas5805m_record_enable_fops = {
+	.owner		= THIS_MODULE,
+	.open		= simple_open,
+	.read		= tas5805m_record_enable_read,
+	.write		= tas5805m_record_enable_write,
+	.llseek		= default_llseek,
+};
+
+struct tas5805m_rec_dump {
+	size_t					size;
+	u8						data[];
+};
+
+/* Linearize the ring into a header plus entries, oldest first */
+static int tas5805m_record_open(struct inode *inode, struct file *file)
+{
+	struct tas5805m_priv *tas5805m = inode->i_private;
+	struct tas5805m_recorder *rec = &tas5805m->rec;
+	struct tas5805m_rec_header *hdr;
+	struct tas5805m_rec_dump *dump;
+	u32 count, first, i;
+
+	mutex_lock(&tas5805m->lock);
+	count = min_t(u32, rec->count, TAS5805M_REC_ENTRIES);
+	if (!rec->buf)
+		count = 0;
+
+	dump = vmalloc(sizeof(*dump) + sizeof(*hdr) +
+		       array_size(count, sizeof(struct tas5805m_rec_entry)));
+	if (!dump) {
+		mutex_unlock(&tas5805m->lock);
+		return -ENOMEM;
+	}
+
+	dump->size = sizeof(*hdr) + count * sizeof(struct tas5805m_rec_entry);
+	hdr = (struct tas5805m_rec_header *)dump->data;
+	memcpy(hdr->magic, "T58R", sizeof(hdr->magic));
+	hdr->version = TAS5805M_REC_VERSION;
+	hdr->addr = tas5805m->i2c->addr;
+	hdr->entry_size = cpu_to_le16(sizeof(struct tas5805m_rec_entry));
+	hdr->count = cpu_to_le32(count);
+	hdr->lost = cpu_to_le32(rec->count - count);
+
+	first = rec->count - count;
+	for (i = 0; i < count; i++)
+		memcpy(dump->data + sizeof(*hdr) + i * sizeof(struct tas5805m_rec_entry),
+		       &rec->buf[(first + i) % TAS5805M_REC_ENTRIES],
+		       sizeof(struct tas5805m_rec_entry));
+	mutex_unlock(&tas5805m->lock);
+
+	file->private_data = dump;
+	return 0;
+}
+
+static ssize_t tas5805m_record_read(struct file *file, char __user *buf,
+				    size_t count, loff_t *ppos)
+{
+	struct tas5805m_rec_dump *dump = file->private_data;
+
+	return simple_read_from_buffer(buf, count, ppos, dump->data, dump->size);
+}
+
+static int tas5805m_record_release(struct inode *inode, struct file *file)
+{
+	vfree(file->private_data);
+	return 0;
+}
+
+static const struct file_operations tas5805m_record_fops = {
+	.owner		= THIS_MODULE,
+	.open		= tas5805m_record_open,
+	.read		= tas5805m_record_read,
+	.llseek		= default_llseek,
+	.release	= tas5805m_record_release,
+};
+
+static void tas5805m_debugfs_init(struct tas5805m_priv *tas5805m)
+{
+	char name[32];
+
+	snprintf(name, sizeof(name), "tas5805m-%s", dev_name(&tas5805m->i2c->dev));
+	tas5805m->debugfs = debugfs_create_dir(name, NULL);
+	debugfs_create_file("stats", 0600, tas5805m->debugfs, tas5805m,
+			    &tas5805m_stats_fops);
+	debugfs_create_file("biquads", 0400, tas5805m->debugfs, tas5805m,
+			    &tas5805m_biquads_fops);
+	debugfs_create_file("record_enable", 0600, tas5805m->debugfs, tas5805m,
+			    &tas5805m_record_enable_fops);
+	debugfs_create_file("record", 0400, tas5805m->debugfs, tas5805m,
+			    &tas5805m_record_fops);
+}
+
 static const struct regmap_config tas5805m_regmap = {
 	.reg_bits	= 8,
 	.val_bits	= 8,
@@ -1310,13 +4165,43 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 	 * incorrectly and the device comes up with an unpredictable I2C
 	 * address.
 	 */
-	tas5805m->vol = TAS5805M_VOLUME_ZERO_DB;
-	tas5805m->gain = TAS5805M_AGAIN_MAX; /* 0dB analog gain */
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++)
+		tas5805m->state.vol[ch] = TAS5805M_VOLUME_ZERO_DB;
+	tas5805m->state.vol_ramp = TAS5805M_VOL_RAMP_DEFAULT;
+	tas5805m->state.gain = TAS5805M_AGAIN_MAX; /* 0dB analog gain */
 	/* Initialize all EQ bands to 0dB (flat response) */
-	for (int i = 0; i < TAS5805M_EQ_BANDS; i++)
-		tas5805m->eq_band[i] = 0;
-	tas5805m->eq_mode = 0; /* EQ On */
-	tas5805m->crossover_freq = 0; /* OFF */
+	memset(tas5805m->eq, 0, sizeof(tas5805m->eq));
+	tas5805m->state.eq_mode = 0; /* EQ On */
+	for (int ch = 0; ch < TAS5805M_CHANNELS; ch++) {
+		tas5805m->state.crossover_freq[ch] = TAS5805M_XO_FREQ_DEFAULT;
+		tas5805m->state.crossover_slope[ch] = TAS5805M_XO_OFF;
+		for (int i = 0; i < TAS5805M_EQ_BANDS; i++)
+			tas5805m->bq_map[ch][i] = i;
+		tas5805m->loud_step[ch] = -1;
+	}
+	tas5805m->state.port.rate = TAS5805M_EQ_TABLE_RATE;
+	tas5805m->state.port.width = 32;
+	tas5805m->state.port.format = TAS5805M_SAP_FMT_I2S;
+	/* Dynamics off, with settings of a gentle compressor and a limiter */
+	tas5805m->state.drc = (struct tas5805m_dyn) {
+		.threshold = -24, .ratio = 4, .attack = 10, .release = 200,
+	};
+	tas5805m->state.agl = (struct tas5805m_dyn) {
+		.threshold = -1, .ratio = 1, .attack = 1, .release = 100,
+	};
+	tas5805m->state.clip_threshold = -3;
+	tas5805m->state.clip_knee = 6;
+	/* Thermal foldback off: when on, 1 dB a second down to -12 dB, back
+	 * after 5 s clear
+	 */
+	tas5805m->state.thermal = (struct tas5805m_thermal) {
+		.enable = 0, .step = 1, .limit = 12, .interval = 1000, .hold = 5000,
+	};
+	/* Auto standby off: Hi-Z after a minute of silence, 20 ms to wake */
+	tas5805m->state.standby = (struct tas5805m_standby) {
+		.enable = 0, .timeout = 60, .poll = 20,
+	};
+	tas5805m->power_since = ktime_get();
 
 	/* Read EQ mode type from device tree (default: off)
 	 * 0 = OFF - no EQ processing
@@ -1347,6 +4232,22 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 		dev_dbg(dev, "%s: EQ mode: 15-band parametric EQ (default)\n", __func__);
 	}
 
+	/* Room correction filters, loaded like the DSP config: no name, no
+	 * filters, but a file that is named must load. They need the EQ
+	 * biquads, so they are ignored with the EQ off.
+	 */
+	if (!device_property_read_string(dev, "ti,room-correction-name", &config_name)) {
+		if (tas5805m->eq_mode_type == TAS5805M_EQ_MODE_OFF) {
+			dev_warn(dev, "%s: room correction needs ti,eq-mode, ignoring %s\n",
+				 __func__, config_name);
+		} else {
+			ret = tas5805m_rc_load(tas5805m, config_name);
+			if (ret)
+				return ret;
+			tas5805m->state.room_correction = 1;
+		}
+	}
+
 	/* Read modulation mode from device tree (default: Hybrid mode)
 	 * 0 = BD modulation
 	 * 1 = 1SPW modulation
@@ -1389,52 +4290,66 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 	 * 2 = Left
 	 * 3 = Right
 	 */
-	if (!device_property_read_u32(dev, "ti,mixer-mode", &tas5805m->mixer_mode)) {
-		if (tas5805m->mixer_mode > 3) {
-			dev_warn(dev, "%s: Invalid mixer mode %u, using Stereo\n", __func__, tas5805m->mixer_mode);
-			tas5805m->mixer_mode = 0;
+	if (!device_property_read_u32(dev, "ti,mixer-mode", &tas5805m->state.mixer_mode)) {
+		if (tas5805m->state.mixer_mode > 3) {
+			dev_warn(dev, "%s: Invalid mixer mode %u, using Stereo\n", __func__, tas5805m->state.mixer_mode);
+			tas5805m->state.mixer_mode = 0;
 		}
 		tas5805m->mixer_mode_from_dt = true;
 		
 		/* Apply the mixer mode values */
-		switch (tas5805m->mixer_mode) {
+		switch (tas5805m->state.mixer_mode) {
 		case 0: /* Stereo */
-			tas5805m->mixer_l2l = 0;
-			tas5805m->mixer_r2l = -110;
-			tas5805m->mixer_l2r = -110;
-			tas5805m->mixer_r2r = 0;
+			tas5805m->state.mixer_l2l = 0;
+			tas5805m->state.mixer_r2l = -110;
+			tas5805m->state.mixer_l2r = -110;
+			tas5805m->state.mixer_r2r = 0;
 			break;
 		case 1: /* Mono */
-			tas5805m->mixer_l2l = -6;
-			tas5805m->mixer_r2l = -6;
-			tas5805m->mixer_l2r = -6;
-			tas5805m->mixer_r2r = -6;
+			tas5805m->state.mixer_l2l = -6;
+			tas5805m->state.mixer_r2l = -6;
+			tas5805m->state.mixer_l2r = -6;
+			tas5805m->state.mixer_r2r = -6;
 			break;
 		case 2: /* Left */
-			tas5805m->mixer_l2l = 0;
-			tas5805m->mixer_r2l = -110;
-			tas5805m->mixer_l2r = 0;
-			tas5805m->mixer_r2r = -110;
+			tas5805m->state.mixer_l2l = 0;
+			tas5805m->state.mixer_r2l = -110;
+			tas5805m->state.mixer_l2r = 0;
+			tas5805m->state.mixer_r2r = -110;
 			break;
 		case 3: /* Right */
-			tas5805m->mixer_l2l = -110;
-			tas5805m->mixer_r2l = 0;
-			tas5805m->mixer_l2r = -110;
-			tas5805m->mixer_r2r = 0;
+			tas5805m->state.mixer_l2l = -110;
+			tas5805m->state.mixer_r2l = 0;
+			tas5805m->state.mixer_l2r = -110;
+			tas5805m->state.mixer_r2r = 0;
 			break;
 		}
-		dev_info(dev, "%s: Mixer mode: %s (from device tree)\n", __func__, mixer_mode_text[tas5805m->mixer_mode]);
+		dev_info(dev, "%s: Mixer mode: %s (from device tree)\n", __func__, mixer_mode_text[tas5805m->state.mixer_mode]);
 	} else {
 		/* Not set in device tree - use runtime defaults and expose controls */
-		tas5805m->mixer_mode = 0; /* Stereo by default */
+		tas5805m->state.mixer_mode = 0; /* Stereo by default */
 		tas5805m->mixer_mode_from_dt = false;
-		tas5805m->mixer_l2l = TAS5805M_MIXER_MAX_DB; /* 0dB L2L */
-		tas5805m->mixer_r2l = TAS5805M_MIXER_MIN_DB; /* Muted R2L */
-		tas5805m->mixer_l2r = TAS5805M_MIXER_MIN_DB; /* Muted L2R */
-		tas5805m->mixer_r2r = TAS5805M_MIXER_MAX_DB; /* 0dB R2R */
+		tas5805m->state.mixer_l2l = TAS5805M_MIXER_MAX_DB; /* 0dB L2L */
+		tas5805m->state.mixer_r2l = TAS5805M_MIXER_MIN_DB; /* Muted R2L */
+		tas5805m->state.mixer_l2r = TAS5805M_MIXER_MIN_DB; /* Muted L2R */
+		tas5805m->state.mixer_r2r = TAS5805M_MIXER_MAX_DB; /* 0dB R2R */
 		dev_dbg(dev, "%s: Mixer controls enabled (runtime configurable)\n", __func__);
 	}
 
+	/* Read TDM slot from device tree (optional)
+	 * First of the two adjacent slots this amp plays when the bus runs in
+	 * TDM mode. Needed for amps attached as aux devices, which do not see
+	 * set_tdm_slot; the primary amp can take its slot from the tx mask.
+	 */
+	if (!device_property_read_u32(dev, "ti,tdm-slot", &tas5805m->state.tdm_slot)) {
+		if (tas5805m->state.tdm_slot >= TAS5805M_TDM_SLOTS_MAX) {
+			dev_warn(dev, "%s: Invalid TDM slot %u, using 0\n", __func__, tas5805m->state.tdm_slot);
+			tas5805m->state.tdm_slot = 0;
+		}
+		tas5805m->tdm_slot_from_dt = true;
+		dev_info(dev, "%s: TDM slot: %u\n", __func__, tas5805m->state.tdm_slot);
+	}
+
 	/* Read bridge mode from device tree (default: normal mode)
 	 * 0 = Normal mode (PBTL disabled)
 	 * 1 = Bridge mode (PBTL enabled)
@@ -1460,10 +4375,19 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 	usleep_range(10000, 15000);
 
 	INIT_WORK(&tas5805m->work, do_work);
+	INIT_DELAYED_WORK(&tas5805m->fault_work, tas5805m_fault_work);
+	INIT_DELAYED_WORK(&tas5805m->thermal_work, tas5805m_thermal_work);
+	INIT_DELAYED_WORK(&tas5805m->standby_work, tas5805m_standby_work);
 	mutex_init(&tas5805m->lock);
+	seqlock_init(&tas5805m->state_lock);
 	
-	/* Add to device list for trigger synchronization */
+	/* Add to device list for trigger synchronization. An amp probed after
+	 * the card set up the bus takes over its serial port settings.
+	 */
 	mutex_lock(&tas5805m_list_mutex);
+	if (!list_empty(&tas5805m_device_list))
+		tas5805m->state.port = list_first_entry(&tas5805m_device_list,
+							struct tas5805m_priv, list)->state.port;
 	list_add_tail(&tas5805m->list, &tas5805m_device_list);
 	mutex_unlock(&tas5805m_list_mutex);
 
@@ -1473,6 +4397,7 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 	int num_controls;
 	const struct snd_kcontrol_new *eq_controls = NULL;
 	size_t eq_controls_size = 0;
+	bool xo_controls = false;
 
 	soc_codec_dev = devm_kzalloc(dev, sizeof(*soc_codec_dev), GFP_KERNEL);
 	if (!soc_codec_dev) {
@@ -1481,7 +4406,9 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 		return -ENOMEM;
 	}
 
-	/* Determine which EQ controls to add based on mode */
+	/* Determine which EQ controls to add based on mode. The crossover
+	 * modes get the EQ bands too, in the biquads the filters leave free.
+	 */
 	switch (tas5805m->eq_mode_type) {
 	case TAS5805M_EQ_MODE_15BAND:
 		eq_controls = tas5805m_snd_controls_eq_15band;
@@ -1489,8 +4416,9 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 		break;
 	case TAS5805M_EQ_MODE_LF_CROSSOVER:
 	case TAS5805M_EQ_MODE_HF_CROSSOVER:
-		eq_controls = tas5805m_snd_controls_crossover;
-		eq_controls_size = sizeof(tas5805m_snd_controls_crossover);
+		eq_controls = tas5805m_snd_controls_eq_15band;
+		eq_controls_size = sizeof(tas5805m_snd_controls_eq_15band);
+		xo_controls = true;
 		break;
 	case TAS5805M_EQ_MODE_OFF:
 	default:
@@ -1500,11 +4428,16 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 	}
 
 	/* Calculate total number of controls */
-	num_controls = ARRAY_SIZE(tas5805m_snd_controls_base);
+	num_controls = ARRAY_SIZE(tas5805m_snd_controls_base) +
+		       ARRAY_SIZE(tas5805m_snd_controls_dynamics);
 	if (!tas5805m->mixer_mode_from_dt)
 		num_controls += ARRAY_SIZE(tas5805m_snd_controls_mixer);
 	if (eq_controls)
 		num_controls += eq_controls_size / sizeof(struct snd_kcontrol_new);
+	if (xo_controls)
+		num_controls += ARRAY_SIZE(tas5805m_snd_controls_crossover);
+	if (tas5805m->rc_filters)
+		num_controls += ARRAY_SIZE(tas5805m_snd_controls_rc);
 
 	/* Allocate and build control array */
 	controls = devm_kmalloc(dev, num_controls * sizeof(struct snd_kcontrol_new), GFP_KERNEL);
@@ -1518,26 +4451,39 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 	memcpy(controls, tas5805m_snd_controls_base, sizeof(tas5805m_snd_controls_base));
 	int offset = ARRAY_SIZE(tas5805m_snd_controls_base);
 
+	memcpy(&controls[offset], tas5805m_snd_controls_dynamics,
+	       sizeof(tas5805m_snd_controls_dynamics));
+	offset += ARRAY_SIZE(tas5805m_snd_controls_dynamics);
+
 	/* Add mixer controls if not controlled by device tree */
 	if (!tas5805m->mixer_mode_from_dt) {
 		memcpy(&controls[offset], tas5805m_snd_controls_mixer, sizeof(tas5805m_snd_controls_mixer));
 		offset += ARRAY_SIZE(tas5805m_snd_controls_mixer);
 	}
 
-	/* Add EQ or crossover controls if applicable */
+	/* Add EQ and crossover controls if applicable */
 	if (eq_controls) {
 		memcpy(&controls[offset], eq_controls, eq_controls_size);
+		offset += eq_controls_size / sizeof(struct snd_kcontrol_new);
+	}
+	if (xo_controls) {
+		memcpy(&controls[offset], tas5805m_snd_controls_crossover,
+		       sizeof(tas5805m_snd_controls_crossover));
+		offset += ARRAY_SIZE(tas5805m_snd_controls_crossover);
 	}
+	if (tas5805m->rc_filters)
+		memcpy(&controls[offset], tas5805m_snd_controls_rc,
+		       sizeof(tas5805m_snd_controls_rc));
 
 	/* Log control registration */
 	if (tas5805m->mixer_mode_from_dt && eq_controls)
 		dev_dbg(dev, "%s: Registered %d controls (mixer from DT, with %s)\n", 
-			__func__, num_controls, tas5805m->eq_mode_type == TAS5805M_EQ_MODE_15BAND ? "15-band EQ" : "crossover");
+			__func__, num_controls, xo_controls ? "crossover and 15-band EQ" : "15-band EQ");
 	else if (tas5805m->mixer_mode_from_dt)
 		dev_dbg(dev, "%s: Registered %d controls (mixer from DT)\n", __func__, num_controls);
 	else if (eq_controls)
 		dev_dbg(dev, "%s: Registered %d controls (with %s)\n", 
-			__func__, num_controls, tas5805m->eq_mode_type == TAS5805M_EQ_MODE_15BAND ? "15-band EQ" : "crossover");
+			__func__, num_controls, xo_controls ? "crossover and 15-band EQ" : "15-band EQ");
 	else
 		dev_dbg(dev, "%s: Registered %d controls\n", __func__, num_controls);
 
@@ -1564,6 +4510,7 @@ static int tas5805m_i2c_probe(struct i2c_client *i2c)
 		return ret;
 	}
 
+	tas5805m_debugfs_init(tas5805m);
 	return 0;
 }
 
@@ -1582,6 +4529,12 @@ static void tas5805m_i2c_remove(struct i2c_client *i2c)
 
 	cancel_work_sync(&tas5805m->work);
 	snd_soc_unregister_component(dev);
+	/* After unregistering, so that no control put re-arms them */
+	cancel_delayed_work_sync(&tas5805m->fault_work);
+	cancel_delayed_work_sync(&tas5805m->thermal_work);
+	cancel_delayed_work_sync(&tas5805m->standby_work);
+	debugfs_remove_recursive(tas5805m->debugfs);
+	vfree(tas5805m->rec.buf);
 	mutex_lock(&tas5805m->lock);
 	tas5805m->dsp_initialized = false;
 	mutex_unlock(&tas5805m->lock);
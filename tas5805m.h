@@ -24,15 +24,21 @@
 #define TAS5805M_REG_DEVICE_CTRL_1   0x02
 #define TAS5805M_REG_DEVICE_CTRL_2   0x03
 #define TAS5805M_REG_SDOUT_SEL       0x30
+#define TAS5805M_REG_SAP_CTRL1       0x33
+#define TAS5805M_REG_SAP_CTRL2       0x34
 #define TAS5805M_REG_CLKDET_STATUS   0x39
 #define TAS5805M_REG_UNDOCUMENTED_0  0x46
 #define TAS5805M_REG_VOL_CTRL        0x4c
+#define TAS5805M_REG_DIG_VOL_CTRL2   0x4e
+#define TAS5805M_REG_AUTO_MUTE_CTRL  0x50
 #define TAS5805M_REG_AUTO_MUTE_TIME  0x51
 #define TAS5805M_REG_ANA_CTRL        0x53
 #define TAS5805M_REG_ANALOG_GAIN     0x54
 #define TAS5805M_REG_ADR_PIN_CTRL    0x60
 #define TAS5805M_REG_ADR_PIN_CONFIG  0x61
 #define TAS5805M_REG_DSP_MISC        0x66
+#define TAS5805M_REG_POWER_STATE     0x68
+#define TAS5805M_REG_AUTOMUTE_STATE  0x69
 #define TAS5805M_REG_CHAN_FAULT      0x70
 #define TAS5805M_REG_GLOBAL_FAULT1   0x71
 #define TAS5805M_REG_GLOBAL_FAULT2   0x72
@@ -53,10 +59,25 @@
  *   0x30 =   0.0 dB  
  *   0xFE = -103.0 dB
  *   0xFF = Mute
- * Hardware step is 0.5 dB, we expose 1.0 dB steps to ALSA
+ * Hardware step is 0.5 dB, ALSA gets the same steps with mute at 0
  */
 #define TAS5805M_VOLUME_MAX	0x00  /* +24 dB */
 #define TAS5805M_VOLUME_MIN	0xFE  /* -103 dB */
+#define TAS5805M_VOLUME_MUTE	0xFF
+
+/* DIG_VOL_CTRL2 (0x4e): volume ramp, bits 7:4 ramping down, 3:0 up.
+ * Each half holds an update rate (bits 3:2, every 1, 2 or 4 samples, or
+ * an immediate change) and a step (bits 1:0, 4, 2, 1 or 0.5 dB).
+ */
+#define TAS5805M_VOL_RAMP_1FS		0x0
+#define TAS5805M_VOL_RAMP_2FS		0x4
+#define TAS5805M_VOL_RAMP_4FS		0x8
+#define TAS5805M_VOL_RAMP_DIRECT	0xc
+#define TAS5805M_VOL_RAMP_4DB		0x0
+#define TAS5805M_VOL_RAMP_2DB		0x1
+#define TAS5805M_VOL_RAMP_1DB		0x2
+#define TAS5805M_VOL_RAMP_0_5DB		0x3
+#define TAS5805M_VOL_RAMP(down, up)	(((down) << 4) | (up))
 #define TAS5805M_VOLUME_ZERO_DB	0x30  /* 0 dB */
 
 #define TAS5805M_AGAIN_MAX 0x00
@@ -84,6 +105,24 @@
 #define TAS5805M_DCTRL2_MUTE		    BIT(3)
 #define TAS5805M_DCTRL2_DIS_DSP		    BIT(4)
 
+/* TAS5805M_REG_SAP_CTRL1 register values */
+#define TAS5805M_SAP_SHIFT_MSB       BIT(7)  /* Bit 8 of the SAP_CTRL2 data offset */
+#define TAS5805M_SAP_FMT_I2S         0x00
+#define TAS5805M_SAP_FMT_TDM         BIT(4)
+#define TAS5805M_SAP_FMT_RTJ         BIT(5)
+#define TAS5805M_SAP_FMT_LTJ         GENMASK(5,4)
+#define TAS5805M_SAP_FMT_MASK        GENMASK(5,4)
+#define TAS5805M_SAP_LRCLK_PULSE     BIT(2)  /* Frame sync shorter than 8 SCLK */
+#define TAS5805M_SAP_WL_16           0x00
+#define TAS5805M_SAP_WL_20           0x01
+#define TAS5805M_SAP_WL_24           0x02
+#define TAS5805M_SAP_WL_32           0x03
+#define TAS5805M_SAP_WL_MASK         GENMASK(1,0)
+
+/* TAS5805M_REG_SAP_CTRL2 holds bits 7:0 of the data offset in SCLK cycles */
+#define TAS5805M_SAP_OFFSET_MAX      0x1ff
+#define TAS5805M_TDM_SLOTS_MAX       16  /* 16 x 32-bit slots fit the offset range */
+
 /* TAS5805M_REG_FAULT register values */
 #define TAS5805M_ANALOG_FAULT_CLEAR 0x80
 
@@ -105,6 +144,58 @@
 #define TAS5805M_REG_LEFT_VOLUME 0x24
 #define TAS5805M_REG_RIGHT_VOLUME 0x28
 
+/* Dynamics coefficient blocks, rates in 1.31 and levels in 9.23 format */
+#define TAS5805M_BOOK_5_DYNAMICS_PAGE 0x2c
+#define TAS5805M_REG_AGL_RELEASE 0x0c
+#define TAS5805M_REG_AGL_ATTACK 0x10
+#define TAS5805M_REG_AGL_THRESHOLD 0x14
+#define TAS5805M_REG_DRC_THRESHOLD 0x1c
+#define TAS5805M_REG_DRC_SLOPE 0x20
+#define TAS5805M_REG_DRC_ATTACK 0x24
+#define TAS5805M_REG_DRC_RELEASE 0x28
+#define TAS5805M_REG_CLIP_CEILING 0x40
+#define TAS5805M_REG_CLIP_KNEE 0x44
+#define TAS5805M_REG_CLIP_CURVE 0x48
+
+/* Dynamics control ranges */
+#define TAS5805M_DRC_THRESHOLD_MIN_DB -60
+#define TAS5805M_AGL_THRESHOLD_MIN_DB -30
+#define TAS5805M_DRC_RATIO_MAX 20
+#define TAS5805M_DYN_ATTACK_MIN_MS 1
+#define TAS5805M_DYN_ATTACK_MAX_MS 200
+#define TAS5805M_DYN_RELEASE_MIN_MS 10
+#define TAS5805M_DYN_RELEASE_MAX_MS 2000
+#define TAS5805M_CLIP_THRESHOLD_MIN_DB -12
+#define TAS5805M_CLIP_KNEE_MAX_DB 12
+
+/* Thermal foldback control ranges */
+#define TAS5805M_THERMAL_STEP_MAX_DB 6
+#define TAS5805M_THERMAL_LIMIT_MAX_DB 24
+#define TAS5805M_THERMAL_INTERVAL_MIN_MS 100
+#define TAS5805M_THERMAL_INTERVAL_MAX_MS 10000
+#define TAS5805M_THERMAL_HOLD_MAX_MS 60000
+
+/* TAS5805M_REG_OT_WARNING bits */
+#define TAS5805M_OT_WARNING BIT(2)
+
+/* TAS5805M_REG_AUTO_MUTE_CTRL: auto-mute on for both channels, muting
+ * them only together. TAS5805M_REG_AUTO_MUTE_TIME: shortest zero-data
+ * time for both channels (11.5 ms at 96 kHz).
+ */
+#define TAS5805M_AUTO_MUTE_BOTH 0x07
+#define TAS5805M_AUTO_MUTE_TIME_MIN 0x00
+
+/* TAS5805M_REG_AUTOMUTE_STATE bits, set while a channel is auto-muted */
+#define TAS5805M_AUTOMUTE_RIGHT BIT(0)
+#define TAS5805M_AUTOMUTE_LEFT BIT(1)
+#define TAS5805M_AUTOMUTE_BOTH (TAS5805M_AUTOMUTE_LEFT | TAS5805M_AUTOMUTE_RIGHT)
+
+/* Auto standby control ranges */
+#define TAS5805M_STANDBY_TIMEOUT_MAX_S 3600
+#define TAS5805M_STANDBY_POLL_MIN_MS 10
+#define TAS5805M_STANDBY_POLL_MAX_MS 1000
+#define TAS5805M_STANDBY_WATCH_MS 1000  /* Silence check while playing */
+
 /* Mixer gain values */
 #define TAS5805M_MIXER_MIN_DB -110
 #define TAS5805M_MIXER_MAX_DB 0
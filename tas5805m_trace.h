@@ -0,0 +1,232 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * Tracepoints for the TAS5805M amplifier driver.
+ *
+ * Every event carries the I2C address of the amplifier so that the timelines
+ * of both amps on a dual board can be told apart. Durations are in
+ * microseconds.
+ */
+
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM tas5805m
+
+#if !defined(_TAS5805M_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define _TAS5805M_TRACE_H
+
+#include <linux/tracepoint.h>
+
+/* Phases of a state refresh, see tas5805m_apply_state() */
+#define TAS5805M_PHASE_CONTROL		0
+#define TAS5805M_PHASE_MIXER		1
+#define TAS5805M_PHASE_EQ		2
+#define TAS5805M_PHASE_CROSSOVER	3
+#define TAS5805M_PHASE_DEVICE_STATE	4
+#define TAS5805M_PHASE_DYNAMICS		5
+
+#define show_tas5805m_phase(phase)					\
+	__print_symbolic(phase,						\
+		{ TAS5805M_PHASE_CONTROL,	"control" },		\
+		{ TAS5805M_PHASE_MIXER,		"mixer" },		\
+		{ TAS5805M_PHASE_EQ,		"eq" },			\
+		{ TAS5805M_PHASE_CROSSOVER,	"crossover" },		\
+		{ TAS5805M_PHASE_DEVICE_STATE,	"device_state" },	\
+		{ TAS5805M_PHASE_DYNAMICS,	"dynamics" })
+
+TRACE_EVENT(tas5805m_trigger,
+
+	TP_PROTO(u16 addr, int cmd),
+
+	TP_ARGS(addr, cmd),
+
+	TP_STRUCT__entry(
+		__field(u16,	addr)
+		__field(int,	cmd)
+	),
+
+	TP_fast_assign(
+		__entry->addr	= addr;
+		__entry->cmd	= cmd;
+	),
+
+	TP_printk("addr=0x%02x cmd=%d", __entry->addr, __entry->cmd)
+);
+
+TRACE_EVENT(tas5805m_work_start,
+
+	TP_PROTO(u16 addr, bool dsp_initialized),
+
+	TP_ARGS(addr, dsp_initialized),
+
+	TP_STRUCT__entry(
+		__field(u16,	addr)
+		__field(bool,	dsp_initialized)
+	),
+
+	TP_fast_assign(
+		__entry->addr		= addr;
+		__entry->dsp_initialized = dsp_initialized;
+	),
+
+	TP_printk("addr=0x%02x dsp_initialized=%d",
+		  __entry->addr, __entry->dsp_initialized)
+);
+
+DECLARE_EVENT_CLASS(tas5805m_duration,
+
+	TP_PROTO(u16 addr, s64 duration_us),
+
+	TP_ARGS(addr, duration_us),
+
+	TP_STRUCT__entry(
+		__field(u16,	addr)
+		__field(s64,	duration_us)
+	),
+
+	TP_fast_assign(
+		__entry->addr		= addr;
+		__entry->duration_us	= duration_us;
+	),
+
+	TP_printk("addr=0x%02x duration_us=%lld",
+		  __entry->addr, __entry->duration_us)
+);
+
+DEFINE_EVENT(tas5805m_duration, tas5805m_work_end,
+
+	TP_PROTO(u16 addr, s64 duration_us),
+
+	TP_ARGS(addr, duration_us)
+);
+
+DEFINE_EVENT(tas5805m_duration, tas5805m_preboot,
+
+	TP_PROTO(u16 addr, s64 duration_us),
+
+	TP_ARGS(addr, duration_us)
+);
+
+TRACE_EVENT(tas5805m_fw_upload,
+
+	TP_PROTO(u16 addr, unsigned int len, s64 duration_us),
+
+	TP_ARGS(addr, len, duration_us),
+
+	TP_STRUCT__entry(
+		__field(u16,		addr)
+		__field(unsigned int,	len)
+		__field(s64,		duration_us)
+	),
+
+	TP_fast_assign(
+		__entry->addr		= addr;
+		__entry->len		= len;
+		__entry->duration_us	= duration_us;
+	),
+
+	TP_printk("addr=0x%02x len=%u duration_us=%lld",
+		  __entry->addr, __entry->len, __entry->duration_us)
+);
+
+TRACE_EVENT(tas5805m_refresh_phase,
+
+	TP_PROTO(u16 addr, unsigned int phase, s64 duration_us),
+
+	TP_ARGS(addr, phase, duration_us),
+
+	TP_STRUCT__entry(
+		__field(u16,		addr)
+		__field(unsigned int,	phase)
+		__field(s64,		duration_us)
+	),
+
+	TP_fast_assign(
+		__entry->addr		= addr;
+		__entry->phase		= phase;
+		__entry->duration_us	= duration_us;
+	),
+
+	TP_printk("addr=0x%02x phase=%s duration_us=%lld",
+		  __entry->addr, show_tas5805m_phase(__entry->phase),
+		  __entry->duration_us)
+);
+
+TRACE_EVENT(tas5805m_refresh,
+
+	TP_PROTO(u16 addr, unsigned int restarts, s64 duration_us),
+
+	TP_ARGS(addr, restarts, duration_us),
+
+	TP_STRUCT__entry(
+		__field(u16,		addr)
+		__field(unsigned int,	restarts)
+		__field(s64,		duration_us)
+	),
+
+	TP_fast_assign(
+		__entry->addr		= addr;
+		__entry->restarts	= restarts;
+		__entry->duration_us	= duration_us;
+	),
+
+	TP_printk("addr=0x%02x restarts=%u duration_us=%lld",
+		  __entry->addr, __entry->restarts, __entry->duration_us)
+);
+
+TRACE_EVENT(tas5805m_fault,
+
+	TP_PROTO(u16 addr, unsigned int chan, unsigned int global1,
+		 unsigned int global2, unsigned int ot_warning),
+
+	TP_ARGS(addr, chan, global1, global2, ot_warning),
+
+	TP_STRUCT__entry(
+		__field(u16,	addr)
+		__field(u8,	chan)
+		__field(u8,	global1)
+		__field(u8,	global2)
+		__field(u8,	ot_warning)
+	),
+
+	TP_fast_assign(
+		__entry->addr		= addr;
+		__entry->chan		= chan;
+		__entry->global1	= global1;
+		__entry->global2	= global2;
+		__entry->ot_warning	= ot_warning;
+	),
+
+	TP_printk("addr=0x%02x chan=0x%02x global1=0x%02x global2=0x%02x ot_warning=0x%02x",
+		  __entry->addr, __entry->chan, __entry->global1,
+		  __entry->global2, __entry->ot_warning)
+);
+
+TRACE_EVENT(tas5805m_dapm,
+
+	TP_PROTO(u16 addr, int event, bool was_powered),
+
+	TP_ARGS(addr, event, was_powered),
+
+	TP_STRUCT__entry(
+		__field(u16,	addr)
+		__field(int,	event)
+		__field(bool,	was_powered)
+	),
+
+	TP_fast_assign(
+		__entry->addr		= addr;
+		__entry->event		= event;
+		__entry->was_powered	= was_powered;
+	),
+
+	TP_printk("addr=0x%02x event=0x%x was_powered=%d",
+		  __entry->addr, __entry->event, __entry->was_powered)
+);
+
+#endif /* _TAS5805M_TRACE_H */
+
+/* This part must be outside protection */
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE tas5805m_trace
+#include <trace/define_trace.h>
@@ -0,0 +1,955 @@
+// SPDX-License-Identifier: GPL-2.0
+//
+// tas5805m-bench: measures the I2C cost of the driver's register
+// programming paths against the counting fake regmap.
+//
+// Each scenario runs on a freshly probed amp. Unless the scenario is about
+// bring-up itself, the amp is brought into the playing state first and the
+// counters are reset just before the measured operations.
+//
+// With -s the fake regmap is backed by the register model in sim.c, which
+// also reports protocol errors, a digest of the final register image and can
+// dump it. Each scenario is then checked against the transfer count,
+// digest and register values in goldens[]. -c additionally checks the
+// image left by the incremental control path against a second amp
+// programmed by a single full refresh, so bus optimisations cannot
+// silently change what ends up in the device.
+
+#include <getopt.h>
+
+#include "harness.h"
+#include "sim.h"
+#include "tas5805m.h"
+
+#define TAS5805M_ADDR		0x2d
+
+/* ti,eq-mode values, see enum tas5805m_eq_mode_type */
+#define EQ_MODE_OFF		0
+#define EQ_MODE_15BAND		1
+#define EQ_MODE_LF_CROSSOVER	2
+#define EQ_MODE_HF_CROSSOVER	3
+
+static const char * const eq_band_names[] = {
+	"00020 Hz", "00032 Hz", "00050 Hz", "00080 Hz", "00125 Hz",
+	"00200 Hz", "00315 Hz", "00500 Hz", "00800 Hz", "01250 Hz",
+	"02000 Hz", "03150 Hz", "05000 Hz", "08000 Hz", "16000 Hz",
+};
+
+struct scenario {
+	const char	*name;
+	const char	*desc;
+	u32		eq_mode;
+	bool		cold;	/* Measure from probe rather than from playing */
+	int		(*run)(struct bench_amp *amp);	/* Returns the number of operations */
+	void		(*setup)(struct bench_amp *amp);	/* Optional, before measuring */
+	void		(*props)(struct bench_amp *amp);	/* Optional, before probe */
+};
+
+static int run_cold_boot(struct bench_amp *amp)
+{
+	bench_amp_start(amp);
+	return 1;
+}
+
+static int run_volume_step(struct bench_amp *amp)
+{
+	long vol = bench_amp_get(amp, "Digital Volume");
+
+	bench_amp_put(amp, "Digital Volume", vol + 1);
+	return 1;
+}
+
+static int run_volume_fade(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Volume Ramp", 6);	/* 0.125 dB/sample */
+	bench_amp_put(amp, "Digital Volume", 51);	/* 0 dB -> -78 dB */
+
+	return 2;
+}
+
+static int run_balance(struct bench_amp *amp)
+{
+	bench_amp_put_channels(amp, "Digital Volume", 207, 195);	/* 0 dB, -6 dB */
+	bench_amp_put(amp, "Balance", 3);
+
+	return 2;
+}
+
+static int run_analog_gain(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Analog Gain", 25);	/* -3 dB */
+	return 1;
+}
+
+/* Stream mute, as the core does when playback stops */
+static int run_mute(struct bench_amp *amp)
+{
+	bench_amp_mute(amp, 1);
+	return 1;
+}
+
+static int run_eq_sweep(struct bench_amp *amp)
+{
+	struct snd_ctl_elem_info info;
+	int ops = 0;
+	long db;
+
+	bench_amp_info(amp, bench_amp_control(amp, eq_band_names[0]), &info);
+
+	for (unsigned int band = 0; band < ARRAY_SIZE(eq_band_names); band++) {
+		for (db = info.value.integer.min; db <= info.value.integer.max; db++, ops++)
+			bench_amp_put(amp, eq_band_names[band], db);
+		bench_amp_put(amp, eq_band_names[band], 0);
+		ops++;
+	}
+
+	return ops;
+}
+
+static int run_eq_preset(struct bench_amp *amp)
+{
+	static const int preset[] = { 4, 3, 2, 1, 0, -1, -2, -2, -1, 0, 1, 2, 3, 3, 2 };
+
+	for (unsigned int band = 0; band < ARRAY_SIZE(eq_band_names); band++)
+		bench_amp_put(amp, eq_band_names[band], preset[band]);
+
+	return ARRAY_SIZE(eq_band_names);
+}
+
+/* The eq_preset curve through the EQ Batch control: one write, one refresh.
+ * The gains read back must match.
+ */
+static int run_eq_batch(struct bench_amp *amp)
+{
+	static const int preset[] = { 4, 3, 2, 1, 0, -1, -2, -2, -1, 0, 1, 2, 3, 3, 2 };
+	u8 batch[4 + 4 * ARRAY_SIZE(preset)] = { 0 }, back[sizeof(batch)];
+
+	for (unsigned int band = 0; band < ARRAY_SIZE(preset); band++) {
+		u32 v = preset[band];
+
+		memcpy(&batch[4 + 4 * band], &v, 4);	/* Host is little endian */
+	}
+
+	bench_amp_put_bytes(amp, "EQ Batch", batch, sizeof(batch));
+	bench_amp_get_bytes(amp, "EQ Batch", back, sizeof(back));
+	if (memcmp(batch, back, sizeof(batch)))
+		fprintf(stderr, "eq_batch: gains read back differ\n");
+
+	return 1;
+}
+
+/* Each channel gets its own curve, then the right one alone is replaced
+ * by an EQ Batch write. Only the right channel's biquads go out for it.
+ */
+static int run_eq_stereo(struct bench_amp *amp)
+{
+	static const int left[] = { 4, 3, 2, 1, 0, -1, -2, -2, -1, 0, 1, 2, 3, 3, 2 };
+	static const int right[] = { 6, 4, 2, 0, -2, -3, -3, -2, -1, 0, 0, 1, 1, 0, -1 };
+	u8 batch[4 + 4 * ARRAY_SIZE(right)] = { 0 }, back[sizeof(batch)];
+
+	for (unsigned int band = 0; band < ARRAY_SIZE(eq_band_names); band++)
+		bench_amp_put_channels(amp, eq_band_names[band], left[band], right[band]);
+
+	batch[1] = 2;	/* Right channel only */
+	for (unsigned int band = 0; band < ARRAY_SIZE(right); band++) {
+		u32 v = left[band];
+
+		memcpy(&batch[4 + 4 * band], &v, 4);
+	}
+
+	bench_amp_put_bytes(amp, "EQ Batch", batch, sizeof(batch));
+	bench_amp_get_bytes(amp, "EQ Batch", back, sizeof(back));
+	if (memcmp(batch, back, sizeof(batch)))
+		fprintf(stderr, "eq_stereo: right gains read back differ\n");
+
+	return ARRAY_SIZE(eq_band_names) + 1;
+}
+
+/* A latched channel fault is found by the next refresh, which mutes the
+ * channel and clears it; the retry 100 ms later unmutes it
+ */
+static int run_fault_clear(struct bench_amp *amp)
+{
+	long vol = bench_amp_get(amp, "Digital Volume");
+
+	if (amp->sim)
+		tas5805m_sim_inject_fault(amp->sim, BIT(1), 0, 0, 0);
+
+	bench_amp_put(amp, "Digital Volume", vol + 1);
+	return 1;
+}
+
+/* A channel fault that comes back at the first retry: the second one is
+ * 200 ms later and finds it clear
+ */
+static int run_fault_retry(struct bench_amp *amp)
+{
+	long vol = bench_amp_get(amp, "Digital Volume");
+
+	if (amp->sim)
+		tas5805m_sim_inject_fault(amp->sim, BIT(0), 0, 0, 0);
+	bench_amp_put(amp, "Digital Volume", vol + 1);
+
+	if (amp->sim)
+		tas5805m_sim_inject_fault(amp->sim, BIT(0), 0, 0, 0);
+	shim_flush_work();
+
+	return 1;
+}
+
+/* A failed biquad write re-initialises the device: every biquad and
+ * coefficient block is written again, without a power cycle
+ */
+static int run_fault_global(struct bench_amp *amp)
+{
+	long vol = bench_amp_get(amp, "Digital Volume");
+
+	if (amp->sim)
+		tas5805m_sim_inject_fault(amp->sim, 0, BIT(6), 0, 0);
+
+	bench_amp_put(amp, "Digital Volume", vol + 1);
+	return 1;
+}
+
+/* With foldback on, the die stays above the warning temperature for
+ * 3.5 s: the volume goes down 1 dB a second, then back up a second apart
+ * once the warning has been clear for 5 s
+ */
+static int run_thermal_foldback(struct bench_amp *amp)
+{
+	long vol = bench_amp_get(amp, "Digital Volume");
+
+	bench_amp_put(amp, "Thermal Foldback Switch", 1);
+	if (amp->sim)
+		amp->sim->hot = true;
+	bench_amp_put(amp, "Digital Volume", vol + 1);
+	shim_run_work_until(shim_time_ns + 3500000000ULL);
+
+	if (amp->sim)
+		amp->sim->hot = false;
+	shim_flush_work();
+
+	return 1;
+}
+
+/* Auto standby with a 2 s timeout through 5 s of silence: the output
+ * stage goes Hi-Z after 2 s and wakes at the first poll that finds signal.
+ * Turned off again at the end, as its polling never stops while on.
+ */
+static int run_auto_standby(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Auto Standby Timeout", 2);
+	bench_amp_put(amp, "Auto Standby Switch", 1);
+
+	if (amp->sim)
+		amp->sim->silent = true;
+	shim_run_work_until(shim_time_ns + 5000000000ULL);
+
+	if (amp->sim)
+		amp->sim->silent = false;
+	shim_run_work_until(shim_time_ns + 100000000ULL);
+
+	bench_amp_put(amp, "Auto Standby Switch", 0);
+	return 3;
+}
+
+static void setup_eq_preset(struct bench_amp *amp)
+{
+	run_eq_preset(amp);
+}
+
+/* Streams at different rates, as a player going through a playlist does.
+ * Coefficients are only rewritten when the rate differs from the last one.
+ */
+static int run_rate_switch(struct bench_amp *amp)
+{
+	static const unsigned int rates[] = { 44100, 44100, 96000, 88200, 48000 };
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(rates); i++) {
+		bench_amp_stop(amp);
+		amp->rate = rates[i];
+		bench_amp_start(amp);
+	}
+
+	return ARRAY_SIZE(rates);
+}
+
+/* Streams in each native format, with 32-bit slots on the bus as the
+ * I2S overlays configure. Only the serial port word length changes.
+ */
+static int run_format_switch(struct bench_amp *amp)
+{
+	static const unsigned int widths[] = { 16, 24, 24, 32 };
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(widths); i++) {
+		bench_amp_stop(amp);
+		amp->width = widths[i];
+		bench_amp_start(amp);
+	}
+
+	return ARRAY_SIZE(widths);
+}
+
+/* The card switches the bus to an 8-slot DSP_A frame and the amp to
+ * slots 4 and 5, as the quad overlay does for the third amp.
+ */
+static int run_tdm_slot(struct bench_amp *amp)
+{
+	bench_amp_stop(amp);
+	bench_amp_set_fmt(amp, SND_SOC_DAIFMT_DSP_A | SND_SOC_DAIFMT_NB_NF |
+			  SND_SOC_DAIFMT_CBC_CFC);
+	bench_amp_set_tdm_slot(amp, 0x30, 8, 32);
+	bench_amp_start(amp);
+
+	return 2;
+}
+
+/* Compressor and limiter switched on and the compressor tuned, as a
+ * player replacing its own dynamics plugin does
+ */
+static int run_dynamics(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "DRC Switch", 1);
+	bench_amp_put(amp, "DRC Threshold", -30);
+	bench_amp_put(amp, "DRC Ratio", 3);
+	bench_amp_put(amp, "AGL Switch", 1);
+
+	return 4;
+}
+
+/* Soft clipper on, then its ceiling lowered: only the clipper block goes out */
+static int run_soft_clipper(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Soft Clipper Switch", 1);
+	bench_amp_put(amp, "Soft Clipper Threshold", -6);
+
+	return 2;
+}
+
+static int run_mixer_mode(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Mixer Mode", 1);	/* Stereo -> Mono */
+	return 1;
+}
+
+/* Some of the left channel into the right one, as for a mono sub */
+static int run_mixer_gain(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Mixer L2R Gain", -6);
+	return 1;
+}
+
+/* The whole EQ bypassed with a curve set */
+static int run_equalizer(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Equalizer", 1);	/* On -> Off */
+	return 1;
+}
+
+/* The frequencies the crossover tables used to offer, then a fine trim
+ * around 80 Hz in 1 Hz steps
+ */
+static int run_crossover_sweep(struct bench_amp *amp)
+{
+	int ops = 0;
+	long hz;
+
+	for (hz = 60; hz <= 150; hz += 10, ops++)
+		bench_amp_put(amp, "Crossover Frequency", hz);
+	for (hz = 75; hz <= 85; hz++, ops++)
+		bench_amp_put(amp, "Crossover Frequency", hz);
+
+	return ops;
+}
+
+static void setup_crossover(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Crossover Slope", 2);	/* Linkwitz-Riley 24dB */
+}
+
+/* Satellites with an LR4 high-pass and the eq_preset curve: its 13 active
+ * bands and the two crossover sections fill the 15 biquads. Then the
+ * crossover moves, which only rewrites the two sections.
+ */
+static int run_crossover_eq(struct bench_amp *amp)
+{
+	size_t len;
+
+	run_eq_preset(amp);
+	bench_amp_put(amp, "Crossover Frequency", 100);
+	free(bench_amp_debugfs_read(amp, "biquads", &len));
+
+	return ARRAY_SIZE(eq_band_names) + 1;
+}
+
+static void setup_loudness(struct bench_amp *amp)
+{
+	bench_amp_put(amp, "Loudness Switch", 1);
+}
+
+/* A 12 dB fade in 0.5 dB steps with loudness on. The shelves are only
+ * redesigned at the two 6 dB steps crossed, and only they are rewritten.
+ */
+static int run_loudness_fade(struct bench_amp *amp)
+{
+	long vol = bench_amp_get(amp, "Digital Volume");
+	size_t len;
+	int i;
+
+	for (i = 1; i <= 24; i++)
+		bench_amp_put(amp, "Digital Volume", vol - i);
+	free(bench_amp_debugfs_read(amp, "biquads", &len));
+
+	return 24;
+}
+
+/* An AutoEQ export with a right-channel filter in the REW format after it */
+static const char room_correction_txt[] =
+	"Preamp: -6.4 dB\n"
+	"Filter 1: ON LSC Fc 105 Hz Gain 5.8 dB Q 0.70\n"
+	"Filter 2: ON PK Fc 180 Hz Gain -3.2 dB Q 0.56\n"
+	"Filter 3: ON PK Fc 1330 Hz Gain 2.4 dB Q 1.73\n"
+	"Filter 4: ON PK Fc 3060 Hz Gain -4.1 dB Q 3.05\n"
+	"Filter 5: ON PK Fc 5400 Hz Gain 3.9 dB Q 2.40\n"
+	"Filter 6: ON HSC Fc 10000 Hz Gain -2.0 dB Q 0.70\n"
+	"Filter 7: OFF PK Fc 7000 Hz Gain 1.0 dB Q 1.00\n"
+	"\n"
+	"Channel: R\n"
+	"Filter  8: ON  PK       Fc   63.0 Hz  Gain  -5.0 dB  Q  4.00\n"
+	"Filter  9: ON  None\n";
+
+static void props_room_correction(struct bench_amp *amp)
+{
+	bench_firmware_set("tas5805m_rc_bench.txt", room_correction_txt,
+			   sizeof(room_correction_txt) - 1);
+	bench_amp_set_string(amp, "ti,room-correction-name", "bench");
+}
+
+/* Room correction off and on again: only its sections are rewritten */
+static int run_room_correction(struct bench_amp *amp)
+{
+	size_t len;
+
+	bench_amp_put(amp, "Room Correction Switch", 0);
+	bench_amp_put(amp, "Room Correction Switch", 1);
+	free(bench_amp_debugfs_read(amp, "biquads", &len));
+
+	return 2;
+}
+
+/* What alsa-restore does: write every control once, in registration order,
+ * with a value that differs from the default.
+ */
+static int run_alsactl_restore(struct bench_amp *amp)
+{
+	int i, ops = 0;
+
+	for (i = 0; i < amp->component.num_kcontrols; i++) {
+		struct snd_kcontrol *kctl = &amp->component.kcontrols[i];
+		struct snd_ctl_elem_info info;
+		long val;
+
+		if (bench_amp_info(amp, kctl, &info))
+			continue;
+
+		switch (info.type) {
+		case SNDRV_CTL_ELEM_TYPE_ENUMERATED:
+			val = info.value.enumerated.items - 1;
+			break;
+		case SNDRV_CTL_ELEM_TYPE_INTEGER:
+		case SNDRV_CTL_ELEM_TYPE_BOOLEAN:
+			val = info.value.integer.min +
+			      (info.value.integer.max - info.value.integer.min) / 3;
+			break;
+		default:
+			continue;
+		}
+
+		bench_amp_put_kctl(amp, kctl, val);
+		ops++;
+	}
+
+	return ops;
+}
+
+static const struct scenario scenarios[] = {
+	{ "cold_boot", "probe, trigger and DSP bring-up", EQ_MODE_15BAND, true, run_cold_boot },
+	{ "volume_step", "one Digital Volume step", EQ_MODE_15BAND, false, run_volume_step },
+	{ "volume_fade", "slowest Volume Ramp, then a 78 dB fade in one write", EQ_MODE_15BAND, false, run_volume_fade },
+	{ "balance", "left and right Digital Volume apart, then Balance moved", EQ_MODE_15BAND, false, run_balance },
+	{ "analog_gain", "Analog Gain to -3 dB", EQ_MODE_15BAND, false, run_analog_gain },
+	{ "mute", "stream mute while playing", EQ_MODE_15BAND, false, run_mute },
+	{ "eq_preset", "all 15 EQ bands set once", EQ_MODE_15BAND, false, run_eq_preset },
+	{ "eq_batch", "the eq_preset curve in one EQ Batch write", EQ_MODE_15BAND, false, run_eq_batch },
+	{ "eq_stereo", "different left and right curves, then a right-only EQ Batch", EQ_MODE_15BAND, false, run_eq_stereo },
+	{ "eq_sweep", "every EQ band through its full range", EQ_MODE_15BAND, false, run_eq_sweep },
+	{ "mixer_mode", "Mixer Mode Stereo to Mono", EQ_MODE_15BAND, false, run_mixer_mode },
+	{ "mixer_gain", "Mixer L2R Gain to -6 dB", EQ_MODE_15BAND, false, run_mixer_gain },
+	{ "equalizer", "Equalizer off with the eq_preset curve set", EQ_MODE_15BAND, false, run_equalizer, setup_eq_preset },
+	{ "crossover_sweep", "LR4 low-pass from 60 to 150 Hz, then 75 to 85 Hz in 1 Hz steps", EQ_MODE_LF_CROSSOVER, false, run_crossover_sweep, setup_crossover },
+	{ "crossover_eq", "HF LR4 crossover plus the eq_preset curve, then the crossover moved", EQ_MODE_HF_CROSSOVER, false, run_crossover_eq, setup_crossover },
+	{ "loudness_fade", "12 dB fade in 0.5 dB steps with loudness on", EQ_MODE_15BAND, false, run_loudness_fade, setup_loudness },
+	{ "room_correction", "room correction filters off and on again", EQ_MODE_15BAND, false, run_room_correction, NULL, props_room_correction },
+	{ "alsactl_restore", "every control written once", EQ_MODE_15BAND, false, run_alsactl_restore },
+	{ "fault_clear", "volume step with a latched fault (needs -s)", EQ_MODE_15BAND, false, run_fault_clear },
+	{ "fault_retry", "channel fault that comes back once (needs -s)", EQ_MODE_15BAND, false, run_fault_retry },
+	{ "fault_global", "volume step with a latched global fault (needs -s)", EQ_MODE_15BAND, false, run_fault_global, setup_eq_preset },
+	{ "thermal_foldback", "over-temperature warning for 3.5 s (needs -s)", EQ_MODE_15BAND, false, run_thermal_foldback },
+	{ "auto_standby", "5 s of silence with a 2 s standby timeout, then signal (needs -s)", EQ_MODE_15BAND, false, run_auto_standby },
+	{ "rate_switch", "stream restarts at 44.1, 44.1, 96, 88.2 and 48 kHz", EQ_MODE_15BAND, false, run_rate_switch, setup_eq_preset },
+	{ "format_switch", "stream restarts as S16, S24, S24 and S32", EQ_MODE_15BAND, false, run_format_switch, setup_eq_preset },
+	{ "dynamics", "DRC and AGL on, DRC threshold and ratio set", EQ_MODE_15BAND, false, run_dynamics },
+	{ "soft_clipper", "soft clipper on and its threshold lowered", EQ_MODE_15BAND, false, run_soft_clipper },
+	{ "tdm_slot", "switch to 8-slot TDM, playing slots 4 and 5", EQ_MODE_15BAND, false, run_tdm_slot },
+};
+
+/* A register the scenario leaves with a known value, or a coefficient of
+ * four bytes
+ */
+struct bench_reg {
+	u8		book, page, reg;
+	u8		len;	/* 0 ends the list */
+	u32		val;
+};
+
+#define BENCH_REG(reg, val) \
+	TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0, reg, 1, val
+#define BENCH_COEF(book, page, reg, val)	book, page, reg, 4, val
+#define BENCH_MIXER(reg, val) \
+	BENCH_COEF(TAS5805M_BOOK_5, TAS5805M_BOOK_5_MIXER_PAGE, reg, val)
+#define BENCH_VOLUME(reg, val) \
+	BENCH_COEF(TAS5805M_BOOK_5, TAS5805M_BOOK_5_VOLUME_PAGE, reg, val)
+
+/* b0 of biquad n, the left bands then the right ones, laid out in book
+ * 0xaa from page 0x24 reg 0x18 across pages of 120 bytes
+ */
+#define BENCH_BQ_ADDR(n)	(16 + 20 * (n))
+#define BENCH_BQ_B0(n, val) \
+	BENCH_COEF(0xaa, 0x24 + BENCH_BQ_ADDR(n) / 120, 0x08 + BENCH_BQ_ADDR(n) % 120, val)
+
+static const struct bench_reg volume_step_regs[] = {
+	{ BENCH_REG(TAS5805M_REG_VOL_CTRL, 0x2f) },	/* +0.5 dB */
+	{ }
+};
+
+static const struct bench_reg volume_fade_regs[] = {
+	{ BENCH_REG(TAS5805M_REG_VOL_CTRL, 0xcc) },	/* -78 dB */
+	{ BENCH_REG(TAS5805M_REG_DIG_VOL_CTRL2, 0xbb) },	/* 0.125 dB/sample */
+	{ }
+};
+
+static const struct bench_reg balance_regs[] = {
+	{ BENCH_REG(TAS5805M_REG_VOL_CTRL, 0x30) },	/* 0 dB, the louder channel */
+	{ BENCH_VOLUME(TAS5805M_REG_LEFT_VOLUME, 0x005a9df7) },	/* -3 dB */
+	{ BENCH_VOLUME(TAS5805M_REG_RIGHT_VOLUME, 0x004026e7) },	/* -6 dB */
+	{ }
+};
+
+static const struct bench_reg analog_gain_regs[] = {
+	{ BENCH_REG(TAS5805M_REG_ANALOG_GAIN, 0x06) },	/* -3 dB */
+	{ }
+};
+
+static const struct bench_reg mute_regs[] = {
+	{ BENCH_REG(TAS5805M_REG_DEVICE_CTRL_2, TAS5805M_DCTRL2_MUTE | TAS5805M_DCTRL2_MODE_PLAY) },
+	{ }
+};
+
+static const struct bench_reg mixer_mode_regs[] = {
+	{ BENCH_MIXER(TAS5805M_REG_LEFT_TO_LEFT_GAIN, 0x00400000) },	/* -6 dB */
+	{ BENCH_MIXER(TAS5805M_REG_RIGHT_TO_LEFT_GAIN, 0x00400000) },
+	{ BENCH_MIXER(TAS5805M_REG_LEFT_TO_RIGHT_GAIN, 0x00400000) },
+	{ BENCH_MIXER(TAS5805M_REG_RIGHT_TO_RIGHT_GAIN, 0x00400000) },
+	{ }
+};
+
+static const struct bench_reg mixer_gain_regs[] = {
+	{ BENCH_MIXER(TAS5805M_REG_LEFT_TO_LEFT_GAIN, 0x00800000) },	/* 0 dB */
+	{ BENCH_MIXER(TAS5805M_REG_RIGHT_TO_LEFT_GAIN, 0x0000001b) },	/* -110 dB */
+	{ BENCH_MIXER(TAS5805M_REG_LEFT_TO_RIGHT_GAIN, 0x00400000) },	/* -6 dB */
+	{ BENCH_MIXER(TAS5805M_REG_RIGHT_TO_RIGHT_GAIN, 0x00800000) },
+	{ }
+};
+
+static const struct bench_reg equalizer_regs[] = {
+	{ BENCH_REG(TAS5805M_REG_DSP_MISC, 0x01) },	/* EQ bypassed */
+	{ }
+};
+
+static const struct bench_reg eq_preset_regs[] = {
+	{ BENCH_BQ_B0(0, 0x08006452) },	/* Left 20 Hz at +4 dB */
+	{ BENCH_BQ_B0(4, 0x08000000) },	/* Left 125 Hz flat */
+	{ BENCH_BQ_B0(15, 0x08006452) },	/* Right 20 Hz */
+	{ BENCH_BQ_B0(19, 0x08000000) },	/* Right 125 Hz */
+	{ }
+};
+
+static const struct bench_reg eq_stereo_regs[] = {
+	{ BENCH_BQ_B0(0, 0x08006452) },	/* Left 20 Hz at +4 dB */
+	{ BENCH_BQ_B0(15, 0x08006452) },	/* Right replaced by the left curve */
+	{ }
+};
+
+static const struct bench_reg crossover_sweep_regs[] = {
+	{ BENCH_BQ_B0(13, 0x0000101a) },	/* 85 Hz low-pass in the top bands */
+	{ BENCH_BQ_B0(14, 0x0000101a) },
+	{ BENCH_BQ_B0(28, 0x0000101a) },
+	{ BENCH_BQ_B0(29, 0x0000101a) },
+	{ }
+};
+
+static const struct bench_reg crossover_eq_regs[] = {
+	{ BENCH_BQ_B0(4, 0x07ed20db) },	/* 100 Hz high-pass in the flat bands */
+	{ BENCH_BQ_B0(9, 0x07ed20db) },
+	{ BENCH_BQ_B0(19, 0x07ed20db) },
+	{ BENCH_BQ_B0(24, 0x07ed20db) },
+	{ }
+};
+
+/* What each scenario gives on the register model with the built-in tables:
+ * the transfers measured, the image digest and the registers it changes.
+ * A driver change that moves any of them has to update this table.
+ */
+static const struct golden {
+	const char		*name;
+	u64			xfers;
+	u32			digest;
+	const struct bench_reg	*regs;
+} goldens[] = {
+	{ "cold_boot", 97, 0xc85dbe75 },
+	{ "volume_step", 28, 0xb3f29efa, volume_step_regs },
+	{ "volume_fade", 56, 0x1573f7b1, volume_fade_regs },
+	{ "balance", 64, 0xa85e20a0, balance_regs },
+	{ "analog_gain", 28, 0x28c18bb3, analog_gain_regs },
+	{ "mute", 28, 0x1cf732fd, mute_regs },
+	{ "eq_preset", 488, 0xabc7069d, eq_preset_regs },
+	{ "eq_batch", 57, 0xabc7069d },
+	{ "eq_stereo", 552, 0xabc7069d, eq_stereo_regs },
+	{ "eq_sweep", 17920, 0xc85dbe75 },
+	{ "mixer_mode", 28, 0x6ac1d645, mixer_mode_regs },
+	{ "mixer_gain", 28, 0x316b3554, mixer_gain_regs },
+	{ "equalizer", 28, 0x436ef7fc, equalizer_regs },
+	{ "crossover_sweep", 840, 0x4551a17d, crossover_sweep_regs },
+	{ "crossover_eq", 555, 0xe24302d5, crossover_eq_regs },
+	{ "loudness_fade", 688, 0xf07a8811 },
+	{ "room_correction", 88, 0x1e792c84 },
+	{ "alsactl_restore", 1264, 0x0cd9217f },
+	{ "fault_clear", 57, 0xb3f29efa },
+	{ "fault_retry", 86, 0xb3f29efa },
+	{ "fault_global", 54, 0x9f2e67e2 },
+	{ "thermal_foldback", 396, 0xb3f29efa },
+	{ "auto_standby", 191, 0xc85dbe75 },
+	{ "rate_switch", 541, 0xabc7069d },
+	{ "format_switch", 340, 0xabc7069d },
+	{ "dynamics", 128, 0x7b670a8c },
+	{ "soft_clipper", 64, 0xc00fc23d },
+	{ "tdm_slot", 85, 0x3c73fb9c },
+};
+
+static bool use_sim;
+static bool dump_image;
+static bool check_image;
+static const char *capture_prefix;
+
+static void print_header(void)
+{
+	printf("%-16s %6s %8s %8s %6s %6s %8s %6s %10s %10s %10s %10s\n",
+	       "scenario", "ops", "xfers", "writes", "bulk", "reads", "bytes",
+	       "pages", "100kHz ms", "400kHz ms", "1MHz ms", "sleep ms");
+}
+
+static void print_result(const char *name, int ops, const struct bench_bus *bus,
+			 u64 elapsed_ns)
+{
+	u64 bus_ns = bench_bus_time_ns(bus, bench_bus_hz);
+
+	printf("%-16s %6d %8llu %8llu %6llu %6llu %8llu %6llu %10.2f %10.2f %10.2f %10.2f\n",
+	       name, ops, bus->xfers, bus->writes, bus->bulk_writes, bus->reads,
+	       bus->bytes, bus->page_selects,
+	       bench_bus_time_ns(bus, 100000) / 1e6,
+	       bench_bus_time_ns(bus, 400000) / 1e6,
+	       bench_bus_time_ns(bus, 1000000) / 1e6,
+	       (elapsed_ns - bus_ns) / 1e6);
+}
+
+static void print_sim(const char *name, const struct tas5805m_sim *sim)
+{
+	const struct tas5805m_sim_stats *st = &sim->stats;
+
+	printf("  %s: image %08x, %llu state changes, %llu fault clears\n",
+	       name, tas5805m_sim_digest(sim), st->state_changes, st->fault_clears);
+
+	if (st->unmapped || st->readonly_writes || st->overruns)
+		printf("  %s: %llu unmapped, %llu read-only writes, %llu page overruns\n",
+		       name, st->unmapped, st->readonly_writes, st->overruns);
+}
+
+/* Compare a run on the register model with the scenario's golden entry.
+ * Returns the number of mismatches.
+ */
+static int check_golden(const struct scenario *sc, const struct bench_bus *bus,
+			const struct tas5805m_sim *sim)
+{
+	const struct golden *g = NULL;
+	int errors = 0;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(goldens); i++)
+		if (!strcmp(goldens[i].name, sc->name))
+			g = &goldens[i];
+
+	if (!g) {
+		printf("  %s: no golden entry\n", sc->name);
+		return 1;
+	}
+
+	if (bus->xfers != g->xfers) {
+		printf("  %s: %llu xfers, golden %llu\n", sc->name, bus->xfers, g->xfers);
+		errors++;
+	}
+
+	if (tas5805m_sim_digest(sim) != g->digest) {
+		printf("  %s: image %08x, golden %08x\n", sc->name,
+		       tas5805m_sim_digest(sim), g->digest);
+		errors++;
+	}
+
+	for (const struct bench_reg *r = g->regs; r && r->len; r++) {
+		u32 val = 0;
+
+		for (unsigned int i = 0; i < r->len; i++)
+			val = val << 8 | tas5805m_sim_peek(sim, r->book, r->page, r->reg + i);
+
+		if (val != r->val) {
+			printf("  %s: book 0x%02x page 0x%02x reg 0x%02x is 0x%0*x, golden 0x%0*x\n",
+			       sc->name, r->book, r->page, r->reg,
+			       2 * r->len, val, 2 * r->len, r->val);
+			errors++;
+		}
+	}
+
+	return errors;
+}
+
+static struct tas5805m_sim *new_sim(void)
+{
+	struct tas5805m_sim *sim = malloc(sizeof(*sim));
+
+	if (sim)
+		tas5805m_sim_reset(sim);
+	return sim;
+}
+
+/* Apply the scenario's controls to a powered-down amp, power it up and
+ * compare the register image after that one full refresh with ref.
+ */
+static int compare_full_refresh(const struct scenario *sc,
+				const struct tas5805m_sim *ref)
+{
+	static const u8 books[] = { 0x00, 0x78, 0x8c, 0xaa };
+	struct bench_amp amp;
+	int diffs = 0;
+
+	bench_amp_init(&amp, TAS5805M_ADDR);
+	amp.sim = new_sim();
+	if (!amp.sim)
+		return -ENOMEM;
+	bench_amp_set_u32(&amp, "ti,eq-mode", sc->eq_mode);
+	if (bench_firmware_path)
+		bench_amp_set_string(&amp, "ti,dsp-config-name", "bench");
+	if (sc->props)
+		sc->props(&amp);
+
+	if (bench_amp_probe(&amp)) {
+		free(amp.sim);
+		return -ENODEV;
+	}
+
+	if (sc->setup)
+		sc->setup(&amp);
+	sc->run(&amp);
+	bench_amp_start(&amp);
+
+	/* Stream mute is not a control, and the start above unmutes */
+	if (tas5805m_sim_peek(ref, TAS5805M_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_0,
+			      TAS5805M_REG_DEVICE_CTRL_2) & TAS5805M_DCTRL2_MUTE)
+		bench_amp_mute(&amp, 1);
+
+	for (unsigned int b = 0; b < ARRAY_SIZE(books); b++)
+		for (unsigned int page = 0; page < TAS5805M_SIM_PAGES; page++)
+			for (unsigned int reg = 1; reg < TAS5805M_SIM_PAGE_SIZE; reg++) {
+				u8 want = tas5805m_sim_peek(amp.sim, books[b], page, reg);
+				u8 got = tas5805m_sim_peek(ref, books[b], page, reg);
+
+				if (want == got)
+					continue;
+
+				if (diffs++ < 16)
+					printf("  %s: book 0x%02x page 0x%02x reg 0x%02x is 0x%02x, full refresh gives 0x%02x\n",
+					       sc->name, books[b], page, reg, got, want);
+			}
+
+	if (diffs)
+		printf("  %s: %d registers differ from a full refresh\n", sc->name, diffs);
+
+	bench_amp_stop(&amp);
+	bench_amp_remove(&amp);
+	free(amp.sim);
+	return diffs ? -EINVAL : 0;
+}
+
+/* Save the driver's write-stream capture as <prefix>-<scenario>.bin */
+static void save_capture(struct bench_amp *amp, const char *name)
+{
+	char path[256];
+	size_t len;
+	void *data;
+	FILE *f;
+
+	bench_amp_debugfs_write(amp, "record_enable", "0");
+	data = bench_amp_debugfs_read(amp, "record", &len);
+	if (!data)
+		return;
+
+	snprintf(path, sizeof(path), "%s-%s.bin", capture_prefix, name);
+	f = fopen(path, "wb");
+	if (!f || fwrite(data, 1, len, f) != len)
+		perror(path);
+	if (f)
+		fclose(f);
+	free(data);
+}
+
+static int run_scenario(const struct scenario *sc)
+{
+	struct bench_amp amp;
+	u64 start = 0;
+	int ops, ret;
+
+	bench_amp_init(&amp, TAS5805M_ADDR);
+	if (use_sim) {
+		amp.sim = new_sim();
+		if (!amp.sim)
+			return -ENOMEM;
+	}
+	bench_amp_set_u32(&amp, "ti,eq-mode", sc->eq_mode);
+	if (bench_firmware_path)
+		bench_amp_set_string(&amp, "ti,dsp-config-name", "bench");
+	if (sc->props)
+		sc->props(&amp);
+
+	if (sc->cold) {
+		bench_bus_reset();
+		start = shim_time_ns;
+	}
+
+	ret = bench_amp_probe(&amp);
+	if (ret) {
+		fprintf(stderr, "%s: probe failed: %d\n", sc->name, ret);
+		return ret;
+	}
+
+	if (capture_prefix && sc->cold)
+		bench_amp_debugfs_write(&amp, "record_enable", "1");
+
+	if (!sc->cold) {
+		bench_amp_start(&amp);
+		if (sc->setup)
+			sc->setup(&amp);
+		bench_bus_reset();
+		start = shim_time_ns;
+		if (capture_prefix)
+			bench_amp_debugfs_write(&amp, "record_enable", "1");
+	}
+
+	ops = sc->run(&amp);
+	shim_flush_work();
+
+	if (capture_prefix)
+		save_capture(&amp, sc->name);
+
+	print_result(sc->name, ops, &bench_bus, shim_time_ns - start);
+	if (amp.sim) {
+		print_sim(sc->name, amp.sim);
+		if (dump_image)
+			tas5805m_sim_dump(amp.sim);
+	}
+
+	/* The golden values hold for the built-in tables only */
+	if (amp.sim && !bench_firmware_path && check_golden(sc, &bench_bus, amp.sim))
+		ret = -EINVAL;
+
+	if (check_image && !sc->cold && compare_full_refresh(sc, amp.sim))
+		ret = -EINVAL;
+
+	bench_amp_stop(&amp);
+	bench_amp_remove(&amp);
+	free(amp.sim);
+	return ret;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"Usage: %s [-v] [-s [-d] [-c]] [-f dsp_config.bin] [-w prefix] [scenario...]\n"
+		"  -v  driver log level, repeat for more (warn, info, debug)\n"
+		"  -s  back the regmap with the TAS5805M register model\n"
+		"  -d  dump the register model after each scenario\n"
+		"  -c  check the register image against a single full refresh\n"
+		"  -f  DSP configuration served to request_firmware()\n"
+		"  -w  save the driver's write-stream capture as <prefix>-<scenario>.bin\n"
+		"\nScenarios:\n", prog);
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(scenarios); i++)
+		fprintf(stderr, "  %-16s %s\n", scenarios[i].name, scenarios[i].desc);
+}
+
+int main(int argc, char **argv)
+{
+	int opt, ret = 0;
+
+	while ((opt = getopt(argc, argv, "vsdcf:w:h")) != -1) {
+		switch (opt) {
+		case 'v':
+			shim_verbose++;
+			break;
+		case 's':
+			use_sim = true;
+			break;
+		case 'd':
+			dump_image = true;
+			break;
+		case 'c':
+			check_image = true;
+			break;
+		case 'f':
+			bench_firmware_path = optarg;
+			break;
+		case 'w':
+			capture_prefix = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if ((dump_image || check_image) && !use_sim) {
+		fprintf(stderr, "-d and -c need -s\n");
+		return 1;
+	}
+
+	print_header();
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(scenarios); i++) {
+		bool selected = optind == argc;
+
+		for (int arg = optind; arg < argc; arg++)
+			if (!strcmp(argv[arg], scenarios[i].name))
+				selected = true;
+
+		if (selected)
+			ret |= run_scenario(&scenarios[i]);
+	}
+
+	return ret ? 1 : 0;
+}
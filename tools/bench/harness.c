@@ -0,0 +1,645 @@
+// SPDX-License-Identifier: GPL-2.0
+//
+// Host-side harness around the unmodified tas5805m.c driver: runtime for
+// the kernel shim, device properties, firmware loading and the ASoC core
+// calls the driver makes.
+
+#include "harness.h"
+
+int shim_verbose;
+u64 shim_time_ns;
+
+extern struct i2c_driver *shim_i2c_driver;
+
+/* Work queue */
+#define BENCH_MAX_WORK	32
+
+static struct work_struct *work_queue[BENCH_MAX_WORK];
+static int work_queued;
+
+bool schedule_work(struct work_struct *w)
+{
+	if (w->pending)
+		return false;
+
+	if (work_queued == BENCH_MAX_WORK) {
+		fprintf(stderr, "bench: work queue overflow\n");
+		exit(1);
+	}
+
+	w->pending = true;
+	work_queue[work_queued++] = w;
+	return true;
+}
+
+bool mod_delayed_work(struct workqueue_struct *wq, struct delayed_work *dw,
+		      unsigned long delay)
+{
+	bool was = dw->work.pending;
+
+	dw->work.due_ns = shim_time_ns + (u64)delay * 1000000;
+	if (!was)
+		schedule_work(&dw->work);
+	return was;
+}
+
+void shim_run_work_until(u64 ns)
+{
+	for (;;) {
+		struct work_struct *w = NULL;
+		int i, next = -1;
+
+		/* Drop cancelled items, pick the earliest due */
+		for (i = 0; i < work_queued; i++) {
+			if (!work_queue[i]->pending) {
+				memmove(&work_queue[i], &work_queue[i + 1],
+					(--work_queued - i) * sizeof(*work_queue));
+				i--;
+			} else if (next < 0 || work_queue[i]->due_ns < work_queue[next]->due_ns) {
+				next = i;
+			}
+		}
+
+		if (next < 0 || work_queue[next]->due_ns > ns)
+			break;
+
+		w = work_queue[next];
+		memmove(&work_queue[next], &work_queue[next + 1],
+			(--work_queued - next) * sizeof(*work_queue));
+		w->pending = false;
+		if (shim_time_ns < w->due_ns)
+			shim_time_ns = w->due_ns;
+		w->func(w);
+	}
+
+	if (ns != U64_MAX && shim_time_ns < ns)
+		shim_time_ns = ns;
+}
+
+void shim_flush_work(void)
+{
+	shim_run_work_until(U64_MAX);
+}
+
+/* Device properties */
+static struct bench_amp *to_amp(struct device *dev)
+{
+	return container_of(dev, struct bench_amp, client.dev);
+}
+
+static struct bench_prop *find_prop(struct device *dev, const char *name)
+{
+	struct bench_amp *amp = to_amp(dev);
+	int i;
+
+	for (i = 0; i < amp->num_props; i++)
+		if (!strcmp(amp->props[i].name, name))
+			return &amp->props[i];
+
+	return NULL;
+}
+
+static struct bench_prop *add_prop(struct bench_amp *amp, const char *name)
+{
+	struct bench_prop *prop = find_prop(&amp->client.dev, name);
+
+	if (prop)
+		return prop;
+
+	if (amp->num_props == BENCH_MAX_PROPS) {
+		fprintf(stderr, "bench: too many properties\n");
+		exit(1);
+	}
+
+	prop = &amp->props[amp->num_props++];
+	prop->name = name;
+	return prop;
+}
+
+void bench_amp_set_u32(struct bench_amp *amp, const char *name, u32 val)
+{
+	struct bench_prop *prop = add_prop(amp, name);
+
+	prop->str = NULL;
+	prop->val = val;
+}
+
+void bench_amp_set_string(struct bench_amp *amp, const char *name, const char *str)
+{
+	add_prop(amp, name)->str = str;
+}
+
+void bench_amp_set_bool(struct bench_amp *amp, const char *name)
+{
+	bench_amp_set_u32(amp, name, 1);
+}
+
+int device_property_read_u32(struct device *dev, const char *name, u32 *val)
+{
+	struct bench_prop *prop = find_prop(dev, name);
+
+	if (!prop || prop->str)
+		return -EINVAL;
+
+	*val = prop->val;
+	return 0;
+}
+
+int device_property_read_string(struct device *dev, const char *name, const char **val)
+{
+	struct bench_prop *prop = find_prop(dev, name);
+
+	if (!prop || !prop->str)
+		return -EINVAL;
+
+	*val = prop->str;
+	return 0;
+}
+
+bool device_property_read_bool(struct device *dev, const char *name)
+{
+	return find_prop(dev, name) != NULL;
+}
+
+/* Firmware: a blob a scenario registered under the requested name, else
+ * whatever file was given on the command line, whatever the name
+ */
+const char *bench_firmware_path;
+
+static const char *bench_firmware_name;
+static const void *bench_firmware_data;
+static size_t bench_firmware_size;
+
+void bench_firmware_set(const char *name, const void *data, size_t size)
+{
+	bench_firmware_name = name;
+	bench_firmware_data = data;
+	bench_firmware_size = size;
+}
+
+int request_firmware(const struct firmware **fw, const char *name, struct device *dev)
+{
+	struct firmware *f;
+	FILE *file;
+	long size;
+	u8 *data;
+
+	if (bench_firmware_name && !strcmp(name, bench_firmware_name)) {
+		f = calloc(1, sizeof(*f));
+		data = malloc(bench_firmware_size ? bench_firmware_size : 1);
+		if (!f || !data) {
+			free(f);
+			free(data);
+			return -ENOMEM;
+		}
+		memcpy(data, bench_firmware_data, bench_firmware_size);
+		f->size = bench_firmware_size;
+		f->data = data;
+		*fw = f;
+		return 0;
+	}
+
+	if (!bench_firmware_path)
+		return -ENOENT;
+
+	file = fopen(bench_firmware_path, "rb");
+	if (!file) {
+		perror(bench_firmware_path);
+		return -ENOENT;
+	}
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	rewind(file);
+
+	f = calloc(1, sizeof(*f));
+	data = malloc(size > 0 ? size : 1);
+	if (!f || !data || fread(data, 1, size, file) != (size_t)size) {
+		fclose(file);
+		free(f);
+		free(data);
+		return -EIO;
+	}
+	fclose(file);
+
+	f->size = size;
+	f->data = data;
+	*fw = f;
+	return 0;
+}
+
+void release_firmware(const struct firmware *fw)
+{
+	if (fw) {
+		free((void *)fw->data);
+		free((void *)fw);
+	}
+}
+
+/* ASoC core */
+int snd_soc_register_component(struct device *dev,
+			       const struct snd_soc_component_driver *drv,
+			       struct snd_soc_dai_driver *dai, int num_dai)
+{
+	struct bench_amp *amp = to_amp(dev);
+	unsigned int i;
+
+	amp->drv = drv;
+	amp->dai_drv = dai;
+	amp->component.dev = dev;
+	amp->component.driver = drv;
+	amp->dapm.component = &amp->component;
+	amp->dai.component = &amp->component;
+
+	amp->component.num_kcontrols = drv->num_controls;
+	amp->component.kcontrols = calloc(drv->num_controls, sizeof(struct snd_kcontrol));
+	for (i = 0; i < drv->num_controls; i++) {
+		struct snd_kcontrol *kctl = &amp->component.kcontrols[i];
+
+		kctl->tmpl = &drv->controls[i];
+		kctl->private_value = drv->controls[i].private_value;
+		kctl->private_data = &amp->component;
+		kctl->id.iface = drv->controls[i].iface;
+		strscpy(kctl->id.name, drv->controls[i].name, sizeof(kctl->id.name));
+	}
+
+	amp->widgets = calloc(drv->num_dapm_widgets, sizeof(*amp->widgets));
+	for (i = 0; i < drv->num_dapm_widgets; i++) {
+		amp->widgets[i] = drv->dapm_widgets[i];
+		amp->widgets[i].dapm = &amp->dapm;
+	}
+
+	amp->registered = true;
+	return 0;
+}
+
+void snd_soc_unregister_component(struct device *dev)
+{
+	struct bench_amp *amp = to_amp(dev);
+
+	free(amp->component.kcontrols);
+	free(amp->widgets);
+	amp->component.kcontrols = NULL;
+	amp->widgets = NULL;
+	amp->registered = false;
+}
+
+int snd_soc_bytes_info_ext(struct snd_kcontrol *kcontrol, struct snd_ctl_elem_info *uinfo)
+{
+	struct soc_bytes_ext *params = (void *)kcontrol->private_value;
+
+	uinfo->type = SNDRV_CTL_ELEM_TYPE_BYTES;
+	uinfo->count = params->max;
+	return 0;
+}
+
+/* debugfs: a flat list of directories and files */
+static struct dentry *debugfs_entries;
+
+static struct dentry *debugfs_add(const char *name, struct dentry *parent, void *data,
+				  const struct file_operations *fops)
+{
+	struct dentry *d = calloc(1, sizeof(*d));
+
+	if (!d)
+		return ERR_PTR(-ENOMEM);
+
+	d->name = strdup(name);
+	d->parent = parent;
+	d->data = data;
+	d->fops = fops;
+	d->next = debugfs_entries;
+	debugfs_entries = d;
+	return d;
+}
+
+struct dentry *debugfs_create_dir(const char *name, struct dentry *parent)
+{
+	return debugfs_add(name, parent, NULL, NULL);
+}
+
+struct dentry *debugfs_create_file(const char *name, unsigned short mode,
+				   struct dentry *parent, void *data,
+				   const struct file_operations *fops)
+{
+	return debugfs_add(name, parent, data, fops);
+}
+
+void debugfs_remove_recursive(struct dentry *dir)
+{
+	struct dentry **p = &debugfs_entries;
+
+	while (*p) {
+		struct dentry *d = *p;
+
+		if (d == dir || d->parent == dir) {
+			*p = d->next;
+			free((void *)d->name);
+			free(d);
+		} else {
+			p = &d->next;
+		}
+	}
+}
+
+static struct dentry *debugfs_find(struct bench_amp *amp, const char *name)
+{
+	void *priv = dev_get_drvdata(&amp->client.dev);
+	struct dentry *d;
+
+	for (d = debugfs_entries; d; d = d->next)
+		if (d->fops && d->data == priv && !strcmp(d->name, name))
+			return d;
+
+	fprintf(stderr, "bench: no debugfs file '%s'\n", name);
+	exit(1);
+}
+
+int bench_amp_debugfs_write(struct bench_amp *amp, const char *name, const char *str)
+{
+	struct dentry *d = debugfs_find(amp, name);
+	struct inode inode = { .i_private = d->data };
+	struct file file = { 0 };
+	loff_t pos = 0;
+	ssize_t ret;
+
+	if (d->fops->open && d->fops->open(&inode, &file))
+		return -EIO;
+
+	ret = d->fops->write(&file, str, strlen(str), &pos);
+
+	if (d->fops->release)
+		d->fops->release(&inode, &file);
+
+	return ret < 0 ? ret : 0;
+}
+
+void *bench_amp_debugfs_read(struct bench_amp *amp, const char *name, size_t *len)
+{
+	struct dentry *d = debugfs_find(amp, name);
+	struct inode inode = { .i_private = d->data };
+	struct file file = { 0 };
+	size_t size = 0, alloc = 4096;
+	char *buf = malloc(alloc);
+	loff_t pos = 0;
+	ssize_t n;
+
+	if (!buf || (d->fops->open && d->fops->open(&inode, &file))) {
+		free(buf);
+		return NULL;
+	}
+
+	while ((n = d->fops->read(&file, buf + size, alloc - size, &pos)) > 0) {
+		size += n;
+		if (size == alloc) {
+			alloc *= 2;
+			buf = realloc(buf, alloc);
+			if (!buf)
+				break;
+		}
+	}
+
+	if (d->fops->release)
+		d->fops->release(&inode, &file);
+
+	*len = size;
+	return buf;
+}
+
+/* Amp instances */
+void bench_amp_init(struct bench_amp *amp, unsigned short addr)
+{
+	memset(amp, 0, sizeof(*amp));
+	amp->client.addr = addr;
+	snprintf(amp->name, sizeof(amp->name), "1-%04x", addr);
+	amp->client.dev.name = amp->name;
+	amp->rate = 48000;
+	amp->width = 32;
+}
+
+/* Probe, then set the DAI format as the card does when it binds */
+int bench_amp_probe(struct bench_amp *amp)
+{
+	int ret = shim_i2c_driver->probe(&amp->client);
+
+	if (ret || !amp->registered)
+		return ret;
+
+	return bench_amp_set_fmt(amp, SND_SOC_DAIFMT_I2S | SND_SOC_DAIFMT_NB_NF |
+				 SND_SOC_DAIFMT_CBC_CFC);
+}
+
+void bench_amp_remove(struct bench_amp *amp)
+{
+	shim_i2c_driver->remove(&amp->client);
+}
+
+struct snd_kcontrol *bench_amp_control(struct bench_amp *amp, const char *name)
+{
+	int i;
+
+	for (i = 0; i < amp->component.num_kcontrols; i++)
+		if (!strcmp(amp->component.kcontrols[i].id.name, name))
+			return &amp->component.kcontrols[i];
+
+	return NULL;
+}
+
+int bench_amp_info(struct bench_amp *amp, struct snd_kcontrol *kctl,
+		   struct snd_ctl_elem_info *info)
+{
+	memset(info, 0, sizeof(*info));
+	info->id = kctl->id;
+	return kctl->tmpl->info(kctl, info);
+}
+
+long bench_amp_get(struct bench_amp *amp, const char *name)
+{
+	struct snd_kcontrol *kctl = bench_amp_control(amp, name);
+	struct snd_ctl_elem_info info;
+	struct snd_ctl_elem_value val;
+
+	if (!kctl) {
+		fprintf(stderr, "bench: no control '%s'\n", name);
+		exit(1);
+	}
+
+	memset(&val, 0, sizeof(val));
+	bench_amp_info(amp, kctl, &info);
+	kctl->tmpl->get(kctl, &val);
+
+	if (info.type == SNDRV_CTL_ELEM_TYPE_ENUMERATED)
+		return val.value.enumerated.item[0];
+
+	return val.value.integer.value[0];
+}
+
+int bench_amp_put_kctl(struct bench_amp *amp, struct snd_kcontrol *kctl, long v)
+{
+	struct snd_ctl_elem_info info;
+	struct snd_ctl_elem_value val;
+	unsigned int i;
+
+	memset(&val, 0, sizeof(val));
+	bench_amp_info(amp, kctl, &info);
+
+	/* Multi-value controls get the same value on every channel */
+	for (i = 0; i < (info.count ? info.count : 1); i++) {
+		if (info.type == SNDRV_CTL_ELEM_TYPE_ENUMERATED)
+			val.value.enumerated.item[i] = v;
+		else
+			val.value.integer.value[i] = v;
+	}
+
+	return kctl->tmpl->put(kctl, &val);
+}
+
+static struct snd_kcontrol *bench_amp_bytes_control(struct bench_amp *amp,
+						    const char *name, size_t len)
+{
+	struct snd_kcontrol *kctl = bench_amp_control(amp, name);
+	struct snd_ctl_elem_info info;
+
+	if (!kctl || bench_amp_info(amp, kctl, &info) ||
+	    info.type != SNDRV_CTL_ELEM_TYPE_BYTES || len > info.count) {
+		fprintf(stderr, "bench: no bytes control '%s' of %zu bytes\n", name, len);
+		exit(1);
+	}
+
+	return kctl;
+}
+
+int bench_amp_put_bytes(struct bench_amp *amp, const char *name, const void *data, size_t len)
+{
+	struct snd_kcontrol *kctl = bench_amp_bytes_control(amp, name, len);
+	struct snd_ctl_elem_value val;
+
+	memset(&val, 0, sizeof(val));
+	memcpy(val.value.bytes.data, data, len);
+	return kctl->tmpl->put(kctl, &val);
+}
+
+int bench_amp_get_bytes(struct bench_amp *amp, const char *name, void *data, size_t len)
+{
+	struct snd_kcontrol *kctl = bench_amp_bytes_control(amp, name, len);
+	struct snd_ctl_elem_value val;
+	int ret;
+
+	memset(&val, 0, sizeof(val));
+	ret = kctl->tmpl->get(kctl, &val);
+	memcpy(data, val.value.bytes.data, len);
+	return ret;
+}
+
+int bench_amp_put(struct bench_amp *amp, const char *name, long v)
+{
+	struct snd_kcontrol *kctl = bench_amp_control(amp, name);
+
+	if (!kctl) {
+		fprintf(stderr, "bench: no control '%s'\n", name);
+		exit(1);
+	}
+
+	return bench_amp_put_kctl(amp, kctl, v);
+}
+
+int bench_amp_put_channels(struct bench_amp *amp, const char *name,
+			   long left, long right)
+{
+	struct snd_kcontrol *kctl = bench_amp_control(amp, name);
+	struct snd_ctl_elem_info info;
+	struct snd_ctl_elem_value val;
+
+	if (!kctl) {
+		fprintf(stderr, "bench: no control '%s'\n", name);
+		exit(1);
+	}
+
+	memset(&val, 0, sizeof(val));
+	bench_amp_info(amp, kctl, &info);
+	if (info.count != 2) {
+		fprintf(stderr, "bench: '%s' is not a stereo control\n", name);
+		exit(1);
+	}
+
+	if (info.type == SNDRV_CTL_ELEM_TYPE_ENUMERATED) {
+		val.value.enumerated.item[0] = left;
+		val.value.enumerated.item[1] = right;
+	} else {
+		val.value.integer.value[0] = left;
+		val.value.integer.value[1] = right;
+	}
+
+	return kctl->tmpl->put(kctl, &val);
+}
+
+void bench_amp_dapm(struct bench_amp *amp, int event)
+{
+	unsigned int i;
+
+	for (i = 0; i < amp->drv->num_dapm_widgets; i++) {
+		struct snd_soc_dapm_widget *w = &amp->widgets[i];
+
+		if (w->event && (w->event_flags & event))
+			w->event(w, NULL, event);
+	}
+}
+
+int bench_amp_trigger(struct bench_amp *amp, int cmd)
+{
+	struct snd_pcm_substream substream = { 0 };
+
+	return amp->dai_drv->ops->trigger(&substream, cmd, &amp->dai);
+}
+
+int bench_amp_hw_params(struct bench_amp *amp, unsigned int rate)
+{
+	struct snd_pcm_substream substream = { 0 };
+	struct snd_pcm_hw_params params = {
+		.rate = rate, .width = amp->width, .physical_width = 32, .channels = 2,
+	};
+
+	amp->rate = rate;
+	if (!amp->dai_drv->ops->hw_params)
+		return 0;
+
+	return amp->dai_drv->ops->hw_params(&substream, &params, &amp->dai);
+}
+
+int bench_amp_set_fmt(struct bench_amp *amp, unsigned int fmt)
+{
+	if (!amp->dai_drv->ops->set_fmt)
+		return 0;
+
+	return amp->dai_drv->ops->set_fmt(&amp->dai, fmt);
+}
+
+int bench_amp_set_tdm_slot(struct bench_amp *amp, unsigned int tx_mask,
+			   int slots, int slot_width)
+{
+	if (!amp->dai_drv->ops->set_tdm_slot)
+		return -EOPNOTSUPP;
+
+	return amp->dai_drv->ops->set_tdm_slot(&amp->dai, tx_mask, 0, slots, slot_width);
+}
+
+int bench_amp_mute(struct bench_amp *amp, int mute)
+{
+	return amp->dai_drv->ops->mute_stream(&amp->dai, mute, 0);
+}
+
+void bench_amp_start(struct bench_amp *amp)
+{
+	bench_amp_hw_params(amp, amp->rate);
+	bench_amp_dapm(amp, SND_SOC_DAPM_POST_PMU);
+	bench_amp_trigger(amp, SNDRV_PCM_TRIGGER_START);
+	shim_flush_work();
+	bench_amp_mute(amp, 0);
+}
+
+void bench_amp_stop(struct bench_amp *amp)
+{
+	bench_amp_mute(amp, 1);
+	bench_amp_trigger(amp, SNDRV_PCM_TRIGGER_STOP);
+	bench_amp_dapm(amp, SND_SOC_DAPM_PRE_PMD);
+}
@@ -0,0 +1,109 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * harness.h - Host-side harness around the unmodified tas5805m.c driver.
+ *
+ * An amp instance bundles the fake I2C client, its device tree properties
+ * and the ASoC objects the driver registers, and offers the calls ALSA
+ * would make: kcontrol puts, DAPM events, PCM trigger and mute.
+ */
+
+#ifndef __BENCH_HARNESS_H__
+#define __BENCH_HARNESS_H__
+
+#include <kshim.h>
+#include <ksound.h>
+
+#define BENCH_MAX_PROPS		16
+
+struct tas5805m_sim;
+
+struct bench_prop {
+	const char		*name;
+	const char		*str;	/* NULL for u32 and boolean properties */
+	u32			val;
+};
+
+struct bench_amp {
+	struct i2c_client	client;
+	char			name[16];
+
+	struct bench_prop	props[BENCH_MAX_PROPS];
+	int			num_props;
+
+	/* Stream rate and sample width passed to hw_params by bench_amp_start() */
+	unsigned int		rate;
+	unsigned int		width;
+
+	/* Register model behind the fake regmap, NULL to only count */
+	struct tas5805m_sim	*sim;
+
+	/* Filled in by snd_soc_register_component() */
+	const struct snd_soc_component_driver *drv;
+	struct snd_soc_dai_driver *dai_drv;
+	struct snd_soc_component component;
+	struct snd_soc_dapm_context dapm;
+	struct snd_soc_dapm_widget *widgets;
+	struct snd_soc_dai	dai;
+	bool			registered;
+};
+
+/* Bus counters kept by the fake regmap, summed over all amps */
+struct bench_bus {
+	u64			xfers;		/* I2C messages */
+	u64			writes;		/* Single register writes */
+	u64			bulk_writes;
+	u64			reads;
+	u64			bytes;		/* Register address plus data */
+	u64			page_selects;	/* Writes to the page or book register */
+	u64			bits;		/* Bus clocks including START/STOP/ACK */
+};
+
+extern struct bench_bus bench_bus;
+extern unsigned long bench_bus_hz;	/* Clock used to advance simulated time */
+
+void bench_bus_reset(void);
+u64 bench_bus_time_ns(const struct bench_bus *bus, unsigned long hz);
+
+/* Firmware served to request_firmware(), NULL if none */
+extern const char *bench_firmware_path;
+/* Serve data for name instead, until cleared with a NULL name */
+void bench_firmware_set(const char *name, const void *data, size_t size);
+
+void bench_amp_init(struct bench_amp *amp, unsigned short addr);
+void bench_amp_set_u32(struct bench_amp *amp, const char *name, u32 val);
+void bench_amp_set_string(struct bench_amp *amp, const char *name, const char *str);
+void bench_amp_set_bool(struct bench_amp *amp, const char *name);
+
+int bench_amp_probe(struct bench_amp *amp);
+void bench_amp_remove(struct bench_amp *amp);
+
+/* ALSA-side entry points */
+struct snd_kcontrol *bench_amp_control(struct bench_amp *amp, const char *name);
+int bench_amp_info(struct bench_amp *amp, struct snd_kcontrol *kctl,
+		   struct snd_ctl_elem_info *info);
+long bench_amp_get(struct bench_amp *amp, const char *name);
+int bench_amp_put(struct bench_amp *amp, const char *name, long val);
+int bench_amp_put_kctl(struct bench_amp *amp, struct snd_kcontrol *kctl, long val);
+int bench_amp_put_channels(struct bench_amp *amp, const char *name, long left, long right);
+int bench_amp_put_bytes(struct bench_amp *amp, const char *name, const void *data, size_t len);
+int bench_amp_get_bytes(struct bench_amp *amp, const char *name, void *data, size_t len);
+void bench_amp_dapm(struct bench_amp *amp, int event);
+int bench_amp_hw_params(struct bench_amp *amp, unsigned int rate);
+int bench_amp_set_fmt(struct bench_amp *amp, unsigned int fmt);
+int bench_amp_set_tdm_slot(struct bench_amp *amp, unsigned int tx_mask,
+			   int slots, int slot_width);
+int bench_amp_trigger(struct bench_amp *amp, int cmd);
+int bench_amp_mute(struct bench_amp *amp, int mute);
+
+/* debugfs files of the amp. Reads return a malloc()ed buffer of *len bytes;
+ * seq_file based files print to stdout instead.
+ */
+int bench_amp_debugfs_write(struct bench_amp *amp, const char *name, const char *str);
+void *bench_amp_debugfs_read(struct bench_amp *amp, const char *name, size_t *len);
+
+/* Full playback start: hw_params at amp->rate and amp->width, DAPM power-up, trigger, DSP work, unmute */
+void bench_amp_start(struct bench_amp *amp);
+/* Playback stop: mute and DAPM power-down */
+void bench_amp_stop(struct bench_amp *amp);
+
+#endif /* __BENCH_HARNESS_H__ */
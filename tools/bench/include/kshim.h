@@ -0,0 +1,500 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * kshim.h - Minimal userspace stand-ins for the kernel and ASoC APIs used
+ * by tas5805m.c, so the driver source can be compiled unmodified into the
+ * host benchmark harness.
+ *
+ * Only what the driver touches is provided. Locks are no-ops (the harness
+ * is single threaded), sleeps are accounted as simulated time instead of
+ * blocking, and register access is routed to the fake regmap in regmap.c.
+ */
+
+#ifndef __KSHIM_H__
+#define __KSHIM_H__
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <ctype.h>
+#include <strings.h>
+
+/* Types */
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef unsigned long long u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef long long s64;
+typedef long long ktime_t;
+typedef unsigned int gfp_t;
+typedef uint16_t __le16;
+typedef uint32_t __le32;
+
+/* The harness only runs on little endian hosts */
+#define cpu_to_le16(x)		((__le16)(x))
+#define cpu_to_le32(x)		((__le32)(x))
+#define le16_to_cpu(x)		((u16)(x))
+#define le32_to_cpu(x)		((u32)(x))
+
+/* Compiler and bit helpers */
+#define __always_unused		__attribute__((unused))
+#define __maybe_unused		__attribute__((unused))
+#define __printf(a, b)		__attribute__((format(printf, a, b)))
+#define __init
+#define __packed		__attribute__((packed))
+#define __exit
+#define READ_ONCE(x)		(x)
+#define WRITE_ONCE(x, v)	((x) = (v))
+
+#define BIT(n)			(1UL << (n))
+#define GENMASK(h, l)		(((~0UL) << (l)) & (~0UL >> (sizeof(long) * 8 - 1 - (h))))
+#define ARRAY_SIZE(a)		(sizeof(a) / sizeof((a)[0]))
+#define container_of(ptr, type, member) \
+	((type *)((char *)(ptr) - offsetof(type, member)))
+#define sizeof_field(type, member)	sizeof(((type *)0)->member)
+#define min(a, b)		((a) < (b) ? (a) : (b))
+#define max(a, b)		((a) > (b) ? (a) : (b))
+#define min_t(t, a, b)		((t)(a) < (t)(b) ? (t)(a) : (t)(b))
+#define max_t(t, a, b)		((t)(a) > (t)(b) ? (t)(a) : (t)(b))
+#define __ffs(x)		((unsigned long)__builtin_ctzl(x))
+#define S32_MAX			INT32_MAX
+#define U64_MAX			UINT64_MAX
+#define S32_MIN			INT32_MIN
+#define clamp(v, lo, hi)	min(max(v, lo), hi)
+#define clamp_t(t, v, lo, hi)	min_t(t, max_t(t, v, lo), hi)
+#define swap(a, b)		do { __typeof__(a) __t = (a); (a) = (b); (b) = __t; } while (0)
+#define DIV_ROUND_UP(n, d)	(((n) + (d) - 1) / (d))
+#define DIV_ROUND_CLOSEST(x, d)	((((x) < 0) ^ ((d) < 0)) ? (((x) - (d) / 2) / (d)) : (((x) + (d) / 2) / (d)))
+#define IS_ENABLED(x)		0
+#define unlikely(x)		(x)
+#define likely(x)		(x)
+
+static inline int fls(unsigned int x)
+{
+	return x ? 32 - __builtin_clz(x) : 0;
+}
+
+static inline int fls64(u64 x)
+{
+	return x ? 64 - __builtin_clzll(x) : 0;
+}
+
+static inline s64 div_s64(s64 a, s32 b)
+{
+	return a / b;
+}
+
+static inline u64 div_u64(u64 a, u32 b)
+{
+	return a / b;
+}
+
+static inline s64 div64_s64(s64 a, s64 b)
+{
+	return a / b;
+}
+
+static inline u64 int_sqrt64(u64 x)
+{
+	u64 r = 0, b = 1ULL << 62;
+
+	while (b > x)
+		b >>= 2;
+	while (b) {
+		if (x >= r + b) {
+			x -= r + b;
+			r = (r >> 1) + b;
+		} else {
+			r >>= 1;
+		}
+		b >>= 2;
+	}
+	return r;
+}
+
+static inline size_t strscpy(char *dst, const char *src, size_t n)
+{
+	snprintf(dst, n, "%s", src);
+	return strlen(dst);
+}
+
+/* Error pointers */
+#define MAX_ERRNO	4095
+#define IS_ERR_VALUE(x)	((unsigned long)(void *)(x) >= (unsigned long)-MAX_ERRNO)
+static inline void *ERR_PTR(long error) { return (void *)error; }
+static inline long PTR_ERR(const void *ptr) { return (long)ptr; }
+static inline bool IS_ERR(const void *ptr) { return IS_ERR_VALUE((unsigned long)ptr); }
+static inline bool IS_ERR_OR_NULL(const void *ptr) { return !ptr || IS_ERR(ptr); }
+
+/* Logging */
+extern int shim_verbose;
+
+struct device {
+	const char		*name;
+	void			*driver_data;
+};
+
+#define __shim_log(lvl, fmt, ...) \
+	do { if (shim_verbose >= (lvl)) fprintf(stderr, fmt, ##__VA_ARGS__); } while (0)
+#define __shim_dev_log(lvl, dev, fmt, ...) \
+	do { (void)(dev); __shim_log(lvl, fmt, ##__VA_ARGS__); } while (0)
+#define dev_err(dev, fmt, ...)	__shim_dev_log(0, dev, fmt, ##__VA_ARGS__)
+#define dev_warn(dev, fmt, ...)	__shim_dev_log(1, dev, fmt, ##__VA_ARGS__)
+#define dev_info(dev, fmt, ...)	__shim_dev_log(2, dev, fmt, ##__VA_ARGS__)
+#define dev_dbg(dev, fmt, ...)	__shim_dev_log(3, dev, fmt, ##__VA_ARGS__)
+#define pr_err(fmt, ...)	__shim_log(0, fmt, ##__VA_ARGS__)
+#define pr_warn(fmt, ...)	__shim_log(1, fmt, ##__VA_ARGS__)
+#define pr_info(fmt, ...)	__shim_log(2, fmt, ##__VA_ARGS__)
+#define pr_debug(fmt, ...)	__shim_log(3, fmt, ##__VA_ARGS__)
+#define WARN_ON(x)		(x)
+#define WARN_ON_ONCE(x)		(x)
+
+static inline const char *dev_name(const struct device *dev)
+{
+	return dev->name;
+}
+
+static inline void *dev_get_drvdata(const struct device *dev)
+{
+	return dev->driver_data;
+}
+
+static inline void dev_set_drvdata(struct device *dev, void *data)
+{
+	dev->driver_data = data;
+}
+
+/* Memory: devm allocations are leaked for the lifetime of the harness */
+#define GFP_KERNEL	0
+static inline void *devm_kzalloc(struct device *dev, size_t size, gfp_t gfp)
+{
+	return calloc(1, size);
+}
+static inline void *devm_kmalloc(struct device *dev, size_t size, gfp_t gfp)
+{
+	return malloc(size);
+}
+static inline void *devm_kcalloc(struct device *dev, size_t n, size_t size, gfp_t gfp)
+{
+	return calloc(n, size);
+}
+static inline void *devm_kmemdup(struct device *dev, const void *src, size_t len, gfp_t gfp)
+{
+	void *p = malloc(len);
+
+	if (p)
+		memcpy(p, src, len);
+	return p;
+}
+static inline char *kmemdup_nul(const char *s, size_t len, gfp_t gfp)
+{
+	char *p = malloc(len + 1);
+
+	if (p) {
+		memcpy(p, s, len);
+		p[len] = '\0';
+	}
+	return p;
+}
+static inline char *skip_spaces(const char *s)
+{
+	while (isspace((unsigned char)*s))
+		s++;
+	return (char *)s;
+}
+static inline void devm_kfree(struct device *dev, const void *p) { free((void *)p); }
+static inline void *kzalloc(size_t size, gfp_t gfp) { return calloc(1, size); }
+static inline void *kmalloc(size_t size, gfp_t gfp) { return malloc(size); }
+static inline void *kcalloc(size_t n, size_t size, gfp_t gfp) { return calloc(n, size); }
+static inline void *kmalloc_array(size_t n, size_t size, gfp_t gfp) { return calloc(n, size); }
+static inline void kfree(const void *p) { free((void *)p); }
+static inline void *vmalloc(size_t size) { return malloc(size); }
+static inline void *vzalloc(size_t size) { return calloc(1, size); }
+static inline void vfree(const void *p) { free((void *)p); }
+#define array_size(a, b)	((size_t)(a) * (size_t)(b))
+
+/* Simulated time: sleeps advance the clock instead of blocking */
+#define MSEC_PER_SEC		1000UL
+#define USEC_PER_SEC		1000000UL
+
+extern u64 shim_time_ns;
+static inline void usleep_range(unsigned long min_us, unsigned long max_us)
+{
+	shim_time_ns += (u64)min_us * 1000;
+}
+static inline void msleep(unsigned int ms)
+{
+	shim_time_ns += (u64)ms * 1000000;
+}
+static inline ktime_t ktime_get(void) { return (ktime_t)shim_time_ns; }
+static inline s64 ktime_to_ns(ktime_t t) { return t; }
+static inline s64 ktime_to_us(ktime_t t) { return t / 1000; }
+static inline s64 ktime_us_delta(ktime_t a, ktime_t b) { return (a - b) / 1000; }
+static inline ktime_t ktime_sub(ktime_t a, ktime_t b) { return a - b; }
+static inline ktime_t ktime_add_us(ktime_t t, u64 us) { return t + us * 1000; }
+static inline ktime_t ktime_add_ms(ktime_t t, u64 ms) { return t + ms * 1000000; }
+static inline bool ktime_before(ktime_t a, ktime_t b) { return a < b; }
+static inline u64 ktime_get_ns(void) { return shim_time_ns; }
+
+/* Locking: the harness is single threaded */
+struct mutex { int unused; };
+#define DEFINE_MUTEX(m)		struct mutex m
+#define mutex_init(m)		do { } while (0)
+#define mutex_lock(m)		((void)(m))
+#define mutex_unlock(m)		((void)(m))
+#define lockdep_assert_held(m)	((void)(m))
+
+typedef struct { unsigned int sequence; } seqlock_t;
+#define seqlock_init(sl)	((sl)->sequence = 0)
+static inline unsigned int read_seqbegin(const seqlock_t *sl) { return sl->sequence; }
+static inline int read_seqretry(const seqlock_t *sl, unsigned int seq) { return sl->sequence != seq; }
+static inline void write_seqlock(seqlock_t *sl) { sl->sequence++; }
+static inline void write_sequnlock(seqlock_t *sl) { sl->sequence++; }
+
+/* Lists */
+struct list_head { struct list_head *next, *prev; };
+#define LIST_HEAD_INIT(name)	{ &(name), &(name) }
+#define LIST_HEAD(name)		struct list_head name = LIST_HEAD_INIT(name)
+static inline void list_add_tail(struct list_head *n, struct list_head *h)
+{
+	n->prev = h->prev;
+	n->next = h;
+	h->prev->next = n;
+	h->prev = n;
+}
+static inline void list_del(struct list_head *e)
+{
+	e->prev->next = e->next;
+	e->next->prev = e->prev;
+}
+#define list_entry(ptr, type, member)	container_of(ptr, type, member)
+#define list_first_entry(head, type, member)	list_entry((head)->next, type, member)
+static inline int list_empty(const struct list_head *h) { return h->next == h; }
+
+#define list_for_each_entry(pos, head, member)				\
+	for (pos = list_entry((head)->next, __typeof__(*pos), member);	\
+	     &pos->member != (head);					\
+	     pos = list_entry(pos->member.next, __typeof__(*pos), member))
+
+/* Work items are queued and run when the harness flushes them */
+struct work_struct;
+typedef void (*work_func_t)(struct work_struct *work);
+struct work_struct {
+	work_func_t		func;
+	bool			pending;
+	u64			due_ns;		/* Delayed work: when it may run */
+};
+#define INIT_WORK(w, f)		do { (w)->func = (f); (w)->pending = false; (w)->due_ns = 0; } while (0)
+bool schedule_work(struct work_struct *w);
+
+/* Delayed work runs at the next flush, which moves the clock on to when
+ * it was due. Jiffies are milliseconds.
+ */
+#define HZ			1000
+#define system_wq		NULL
+static inline unsigned long msecs_to_jiffies(unsigned int ms) { return ms; }
+struct workqueue_struct;
+struct delayed_work {
+	struct work_struct	work;
+};
+#define INIT_DELAYED_WORK(w, f)	INIT_WORK(&(w)->work, f)
+#define to_delayed_work(w)	container_of(w, struct delayed_work, work)
+bool mod_delayed_work(struct workqueue_struct *wq, struct delayed_work *dw,
+		      unsigned long delay);
+static inline bool work_pending(struct work_struct *w) { return w->pending; }
+#define delayed_work_pending(dw)	work_pending(&(dw)->work)
+static inline bool cancel_work_sync(struct work_struct *w)
+{
+	bool was = w->pending;
+
+	w->pending = false;
+	return was;
+}
+static inline bool cancel_delayed_work_sync(struct delayed_work *dw)
+{
+	return cancel_work_sync(&dw->work);
+}
+void shim_flush_work(void);
+/* Run the work due by then, earliest first, and move the clock on to it */
+void shim_run_work_until(u64 ns);
+
+/* Regmap: implemented by the harness's counting fake */
+struct regmap;
+struct regmap_config {
+	int			reg_bits;
+	int			val_bits;
+	int			cache_type;
+};
+#define REGCACHE_NONE	0
+int regmap_write(struct regmap *map, unsigned int reg, unsigned int val);
+int regmap_read(struct regmap *map, unsigned int reg, unsigned int *val);
+int regmap_bulk_write(struct regmap *map, unsigned int reg, const void *val, size_t count);
+int regmap_raw_write(struct regmap *map, unsigned int reg, const void *val, size_t len);
+int regmap_bulk_read(struct regmap *map, unsigned int reg, void *val, size_t count);
+
+/* I2C */
+struct i2c_client {
+	struct device		dev;
+	unsigned short		addr;
+};
+struct i2c_device_id { const char *name; unsigned long driver_data; };
+struct of_device_id { const char *compatible; const void *data; };
+struct i2c_driver {
+	int (*probe)(struct i2c_client *client);
+	void (*remove)(struct i2c_client *client);
+	const struct i2c_device_id *id_table;
+	struct {
+		const char			*name;
+		const struct of_device_id	*of_match_table;
+	} driver;
+};
+struct regmap *devm_regmap_init_i2c(struct i2c_client *i2c, const struct regmap_config *config);
+
+/* Device properties: backed by the harness's property table */
+int device_property_read_u32(struct device *dev, const char *name, u32 *val);
+int device_property_read_string(struct device *dev, const char *name, const char **val);
+bool device_property_read_bool(struct device *dev, const char *name);
+
+/* Firmware */
+struct firmware {
+	size_t			size;
+	const u8		*data;
+};
+int request_firmware(const struct firmware **fw, const char *name, struct device *dev);
+void release_firmware(const struct firmware *fw);
+
+/* Regulator and GPIO: no hardware, always succeed */
+struct regulator { int unused; };
+struct gpio_desc { int value; };
+enum gpiod_flags { GPIOD_OUT_LOW, GPIOD_OUT_HIGH };
+static inline struct regulator *devm_regulator_get(struct device *dev, const char *id)
+{
+	static struct regulator reg;
+
+	return &reg;
+}
+static inline int regulator_enable(struct regulator *r) { return 0; }
+static inline int regulator_disable(struct regulator *r) { return 0; }
+static inline struct gpio_desc *devm_gpiod_get(struct device *dev, const char *id, enum gpiod_flags f)
+{
+	return calloc(1, sizeof(struct gpio_desc));
+}
+static inline void gpiod_set_value(struct gpio_desc *d, int v) { d->value = v; }
+
+/* debugfs and seq_file: files are kept in a list by the harness, which can
+ * open, read and write them through their file_operations. seq_file output
+ * goes to stdout.
+ */
+#define __user
+typedef long ssize_t;
+struct module;
+#define THIS_MODULE		((struct module *)NULL)
+struct file_operations;
+struct dentry {
+	const char		*name;
+	struct dentry		*parent;
+	void			*data;
+	const struct file_operations *fops;
+	struct dentry		*next;
+};
+struct inode { void *i_private; };
+struct file { void *private_data; };
+struct seq_file {
+	void			*private;
+	int			(*show)(struct seq_file *m, void *v);
+};
+struct file_operations {
+	struct module *owner;
+	int (*open)(struct inode *, struct file *);
+	ssize_t (*read)(struct file *, char *, size_t, loff_t *);
+	ssize_t (*write)(struct file *, const char *, size_t, loff_t *);
+	loff_t (*llseek)(struct file *, loff_t, int);
+	int (*release)(struct inode *, struct file *);
+};
+#define seq_printf(m, ...)	((void)(m), printf(__VA_ARGS__))
+#define seq_puts(m, s)		((void)(m), fputs(s, stdout))
+#define seq_putc(m, c)		((void)(m), putchar(c))
+static inline int single_open(struct file *file, int (*show)(struct seq_file *, void *), void *data)
+{
+	struct seq_file *m = calloc(1, sizeof(*m));
+
+	if (!m)
+		return -ENOMEM;
+	m->private = data;
+	m->show = show;
+	file->private_data = m;
+	return 0;
+}
+static inline int single_release(struct inode *inode, struct file *file)
+{
+	free(file->private_data);
+	return 0;
+}
+static inline ssize_t seq_read(struct file *f, char *buf, size_t n, loff_t *pos)
+{
+	struct seq_file *m = f->private_data;
+
+	if (*pos == 0)
+		m->show(m, NULL);
+	*pos = 1;
+	return 0;
+}
+static inline loff_t seq_lseek(struct file *f, loff_t off, int whence) { return off; }
+struct dentry *debugfs_create_dir(const char *name, struct dentry *parent);
+struct dentry *debugfs_create_file(const char *name, unsigned short mode,
+				   struct dentry *parent, void *data,
+				   const struct file_operations *fops);
+void debugfs_remove_recursive(struct dentry *d);
+static inline int simple_open(struct inode *inode, struct file *file)
+{
+	file->private_data = inode->i_private;
+	return 0;
+}
+static inline loff_t default_llseek(struct file *f, loff_t off, int whence) { return off; }
+static inline ssize_t simple_read_from_buffer(void *to, size_t count, loff_t *ppos,
+					      const void *from, size_t available)
+{
+	size_t n;
+
+	if (*ppos < 0 || (size_t)*ppos >= available)
+		return 0;
+	n = min(count, available - (size_t)*ppos);
+	memcpy(to, (const char *)from + *ppos, n);
+	*ppos += n;
+	return n;
+}
+static inline int kstrtobool_from_user(const char *s, size_t count, bool *res)
+{
+	if (!count)
+		return -EINVAL;
+	switch (s[0]) {
+	case '1': case 'y': case 'Y':
+		*res = true;
+		return 0;
+	case '0': case 'n': case 'N':
+		*res = false;
+		return 0;
+	}
+	return -EINVAL;
+}
+
+/* Module boilerplate */
+#define MODULE_AUTHOR(x)
+#define MODULE_DESCRIPTION(x)
+#define MODULE_LICENSE(x)
+#define MODULE_DEVICE_TABLE(type, name)
+#define module_i2c_driver(drv) \
+	struct i2c_driver *shim_i2c_driver = &(drv)
+#define of_match_ptr(x)		NULL
+#define module_param(name, type, perm)
+#define MODULE_PARM_DESC(name, desc)
+
+#endif /* __KSHIM_H__ */
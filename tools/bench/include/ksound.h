@@ -0,0 +1,265 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * ksound.h - Minimal userspace stand-ins for the ALSA control, PCM and ASoC
+ * structures used by tas5805m.c. See kshim.h.
+ */
+
+#ifndef __KSOUND_H__
+#define __KSOUND_H__
+
+#include "kshim.h"
+
+/* Controls */
+#define SNDRV_CTL_ELEM_TYPE_BOOLEAN	1
+#define SNDRV_CTL_ELEM_TYPE_INTEGER	2
+#define SNDRV_CTL_ELEM_TYPE_ENUMERATED	3
+#define SNDRV_CTL_ELEM_TYPE_BYTES	4
+
+#define SNDRV_CTL_ELEM_IFACE_MIXER	2
+
+#define SNDRV_CTL_ELEM_ACCESS_READ		(1 << 0)
+#define SNDRV_CTL_ELEM_ACCESS_WRITE		(1 << 1)
+#define SNDRV_CTL_ELEM_ACCESS_READWRITE		(SNDRV_CTL_ELEM_ACCESS_READ | SNDRV_CTL_ELEM_ACCESS_WRITE)
+#define SNDRV_CTL_ELEM_ACCESS_VOLATILE		(1 << 2)
+#define SNDRV_CTL_ELEM_ACCESS_TLV_READ		(1 << 4)
+#define SNDRV_CTL_ELEM_ACCESS_TLV_WRITE		(1 << 5)
+#define SNDRV_CTL_ELEM_ACCESS_TLV_READWRITE	(SNDRV_CTL_ELEM_ACCESS_TLV_READ | SNDRV_CTL_ELEM_ACCESS_TLV_WRITE)
+#define SNDRV_CTL_ELEM_ACCESS_TLV_CALLBACK	(1 << 28)
+
+#define SNDRV_CTL_TLVT_DB_SCALE		1
+#define SNDRV_CTL_TLVD_DB_SCALE_MUTE	0x10000
+#define SNDRV_CTL_TLVD_DECLARE_DB_SCALE(name, min, step, mute) \
+	unsigned int name[] = { SNDRV_CTL_TLVT_DB_SCALE, 2 * sizeof(unsigned int), \
+		(unsigned int)(min), ((step) & 0xffff) | ((mute) ? SNDRV_CTL_TLVD_DB_SCALE_MUTE : 0) }
+#define DECLARE_TLV_DB_SCALE(name, min, step, mute) \
+	SNDRV_CTL_TLVD_DECLARE_DB_SCALE(name, min, step, mute)
+
+struct snd_ctl_elem_id {
+	unsigned int		numid;
+	int			iface;
+	char			name[44];
+	unsigned int		index;
+};
+
+struct snd_ctl_elem_info {
+	struct snd_ctl_elem_id	id;
+	int			type;
+	unsigned int		access;
+	unsigned int		count;
+	union {
+		struct {
+			long		min;
+			long		max;
+			long		step;
+		} integer;
+		struct {
+			unsigned int	items;
+			unsigned int	item;
+			char		name[64];
+		} enumerated;
+	} value;
+};
+
+struct snd_ctl_elem_value {
+	struct snd_ctl_elem_id	id;
+	union {
+		union {
+			long		value[128];
+		} integer;
+		union {
+			unsigned int	item[128];
+		} enumerated;
+		union {
+			unsigned char	data[512];
+		} bytes;
+	} value;
+};
+
+struct snd_kcontrol;
+typedef int (snd_kcontrol_info_t)(struct snd_kcontrol *, struct snd_ctl_elem_info *);
+typedef int (snd_kcontrol_get_t)(struct snd_kcontrol *, struct snd_ctl_elem_value *);
+typedef int (snd_kcontrol_put_t)(struct snd_kcontrol *, struct snd_ctl_elem_value *);
+typedef int (snd_kcontrol_tlv_rw_t)(struct snd_kcontrol *, int, unsigned int, unsigned int *);
+
+struct snd_kcontrol_new {
+	int			iface;
+	unsigned int		device;
+	unsigned int		subdevice;
+	const char		*name;
+	unsigned int		index;
+	unsigned int		access;
+	unsigned int		count;
+	snd_kcontrol_info_t	*info;
+	snd_kcontrol_get_t	*get;
+	snd_kcontrol_put_t	*put;
+	union {
+		snd_kcontrol_tlv_rw_t	*c;
+		const unsigned int	*p;
+	} tlv;
+	unsigned long		private_value;
+};
+
+struct snd_kcontrol {
+	struct snd_ctl_elem_id	id;
+	unsigned long		private_value;
+	void			*private_data;
+	const struct snd_kcontrol_new *tmpl;
+};
+
+/* PCM */
+#define SNDRV_PCM_RATE_44100	(1 << 6)
+#define SNDRV_PCM_RATE_48000	(1 << 7)
+#define SNDRV_PCM_RATE_88200	(1 << 9)
+#define SNDRV_PCM_RATE_96000	(1 << 10)
+
+#define SNDRV_PCM_FMTBIT_S16_LE		(1ULL << 2)
+#define SNDRV_PCM_FMTBIT_S24_LE		(1ULL << 6)
+#define SNDRV_PCM_FMTBIT_S32_LE		(1ULL << 10)
+#define SNDRV_PCM_FMTBIT_S24_3LE	(1ULL << 32)
+
+#define SNDRV_PCM_TRIGGER_STOP		0
+#define SNDRV_PCM_TRIGGER_START		1
+#define SNDRV_PCM_TRIGGER_PAUSE_PUSH	3
+#define SNDRV_PCM_TRIGGER_PAUSE_RELEASE	4
+#define SNDRV_PCM_TRIGGER_SUSPEND	5
+#define SNDRV_PCM_TRIGGER_RESUME	6
+
+struct snd_pcm_substream { int stream; };
+
+struct snd_pcm_hw_params {
+	unsigned int		rate;
+	unsigned int		width;
+	unsigned int		physical_width;
+	unsigned int		channels;
+};
+static inline unsigned int params_rate(const struct snd_pcm_hw_params *p) { return p->rate; }
+static inline int params_width(const struct snd_pcm_hw_params *p) { return p->width; }
+static inline int params_physical_width(const struct snd_pcm_hw_params *p) { return p->physical_width; }
+static inline unsigned int params_channels(const struct snd_pcm_hw_params *p) { return p->channels; }
+
+/* ASoC */
+struct snd_soc_component {
+	struct device		*dev;
+	const struct snd_soc_component_driver *driver;
+	struct snd_kcontrol	*kcontrols;
+	int			num_kcontrols;
+};
+
+static inline void *snd_soc_component_get_drvdata(struct snd_soc_component *c)
+{
+	return dev_get_drvdata(c->dev);
+}
+
+static inline struct snd_soc_component *snd_soc_kcontrol_component(struct snd_kcontrol *k)
+{
+	return k->private_data;
+}
+
+struct snd_soc_dapm_context {
+	struct snd_soc_component *component;
+};
+
+static inline struct snd_soc_component *snd_soc_dapm_to_component(struct snd_soc_dapm_context *d)
+{
+	return d->component;
+}
+
+#define SND_SOC_NOPM		-1
+#define SND_SOC_DAPM_PRE_PMU	0x1
+#define SND_SOC_DAPM_POST_PMU	0x2
+#define SND_SOC_DAPM_PRE_PMD	0x4
+#define SND_SOC_DAPM_POST_PMD	0x8
+
+struct snd_soc_dapm_widget {
+	const char		*name;
+	struct snd_soc_dapm_context *dapm;
+	int (*event)(struct snd_soc_dapm_widget *, struct snd_kcontrol *, int);
+	unsigned short		event_flags;
+};
+
+struct snd_soc_dapm_route {
+	const char		*sink;
+	const char		*control;
+	const char		*source;
+};
+
+#define SND_SOC_DAPM_AIF_IN(wname, stname, wchan, wreg, wshift, winvert) \
+	{ .name = wname }
+#define SND_SOC_DAPM_DAC_E(wname, stname, wreg, wshift, winvert, wevent, wflags) \
+	{ .name = wname, .event = wevent, .event_flags = wflags }
+#define SND_SOC_DAPM_OUTPUT(wname) \
+	{ .name = wname }
+
+#define SND_SOC_DAIFMT_I2S		1
+#define SND_SOC_DAIFMT_RIGHT_J		2
+#define SND_SOC_DAIFMT_LEFT_J		3
+#define SND_SOC_DAIFMT_DSP_A		4
+#define SND_SOC_DAIFMT_DSP_B		5
+#define SND_SOC_DAIFMT_FORMAT_MASK	0x000f
+#define SND_SOC_DAIFMT_NB_NF		(0 << 8)
+#define SND_SOC_DAIFMT_INV_MASK		0x0f00
+#define SND_SOC_DAIFMT_CBC_CFC		(4 << 12)
+#define SND_SOC_DAIFMT_CBS_CFS		SND_SOC_DAIFMT_CBC_CFC
+#define SND_SOC_DAIFMT_CLOCK_PROVIDER_MASK	0xf000
+#define SND_SOC_DAIFMT_MASTER_MASK	SND_SOC_DAIFMT_CLOCK_PROVIDER_MASK
+
+struct snd_soc_dai {
+	struct snd_soc_component *component;
+	int			id;
+};
+
+struct snd_soc_dai_ops {
+	int (*hw_params)(struct snd_pcm_substream *, struct snd_pcm_hw_params *, struct snd_soc_dai *);
+	int (*set_fmt)(struct snd_soc_dai *, unsigned int);
+	int (*set_tdm_slot)(struct snd_soc_dai *, unsigned int, unsigned int, int, int);
+	int (*trigger)(struct snd_pcm_substream *, int, struct snd_soc_dai *);
+	int (*mute_stream)(struct snd_soc_dai *, int, int);
+	unsigned int		no_capture_mute:1;
+};
+
+struct snd_soc_pcm_stream {
+	const char		*stream_name;
+	u64			formats;
+	unsigned int		rates;
+	unsigned int		rate_min;
+	unsigned int		rate_max;
+	unsigned int		channels_min;
+	unsigned int		channels_max;
+};
+
+struct snd_soc_dai_driver {
+	const char		*name;
+	struct snd_soc_pcm_stream playback;
+	const struct snd_soc_dai_ops *ops;
+};
+
+struct snd_soc_component_driver {
+	const char		*name;
+	int (*probe)(struct snd_soc_component *);
+	void (*remove)(struct snd_soc_component *);
+	const struct snd_kcontrol_new *controls;
+	unsigned int		num_controls;
+	const struct snd_soc_dapm_widget *dapm_widgets;
+	unsigned int		num_dapm_widgets;
+	const struct snd_soc_dapm_route *dapm_routes;
+	unsigned int		num_dapm_routes;
+	unsigned int		use_pmdown_time:1;
+	unsigned int		endianness:1;
+};
+
+int snd_soc_register_component(struct device *dev,
+			       const struct snd_soc_component_driver *drv,
+			       struct snd_soc_dai_driver *dai, int num_dai);
+void snd_soc_unregister_component(struct device *dev);
+
+struct soc_bytes_ext {
+	int			max;
+};
+#define SND_SOC_BYTES_EXT(xname, xcount, xhandler_get, xhandler_put) \
+{	.iface = SNDRV_CTL_ELEM_IFACE_MIXER, .name = xname, \
+	.info = snd_soc_bytes_info_ext, \
+	.get = xhandler_get, .put = xhandler_put, \
+	.private_value = (unsigned long)&(struct soc_bytes_ext) {.max = xcount} }
+int snd_soc_bytes_info_ext(struct snd_kcontrol *kcontrol, struct snd_ctl_elem_info *uinfo);
+
+#endif /* __KSOUND_H__ */
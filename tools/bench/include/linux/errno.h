@@ -0,0 +1,4 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* The C library reaches the system header through <errno.h> */
+#include_next <linux/errno.h>
+#include "../kshim.h"
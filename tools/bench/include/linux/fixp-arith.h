@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * Same interface and interpolation as the kernel's fixp-arith.h: a sine per
+ * whole degree in Q31, linearly interpolated in between.
+ */
+#ifndef __BENCH_FIXP_ARITH_H__
+#define __BENCH_FIXP_ARITH_H__
+
+#include <math.h>
+#include "../kshim.h"
+
+static inline s32 __fixp_sin32(int degrees)
+{
+	bool negative = false;
+
+	degrees %= 360;
+	if (degrees < 0)
+		degrees += 360;
+	if (degrees > 180) {
+		negative = true;
+		degrees -= 180;
+	}
+	if (degrees > 90)
+		degrees = 180 - degrees;
+
+	s32 ret = (s32)(sin(degrees * M_PI / 180) * 0x7fffffff);
+
+	return negative ? -ret : ret;
+}
+
+static inline s32 fixp_sin32_rad(u32 radians, u32 twopi)
+{
+	int degrees;
+	s32 v1, v2, dx, dy;
+	s64 tmp;
+
+	degrees = (radians * 360) / twopi;
+	tmp = radians - (degrees * twopi) / 360;
+
+	v1 = __fixp_sin32(degrees);
+	v2 = __fixp_sin32(degrees + 1);
+	dx = twopi / 360;
+	dy = v2 - v1;
+
+	tmp *= dy;
+
+	return v1 + tmp / dx;
+}
+
+#define fixp_cos32_rad(rad, twopi)	fixp_sin32_rad(rad + twopi / 4, twopi)
+
+#endif /* __BENCH_FIXP_ARITH_H__ */
@@ -0,0 +1,19 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * Tracepoints compile to empty inline functions in the userspace build.
+ */
+#ifndef __SHIM_TRACEPOINT_H__
+#define __SHIM_TRACEPOINT_H__
+
+#include "../kshim.h"
+
+#define TP_PROTO(...)		__VA_ARGS__
+#define TP_ARGS(...)		__VA_ARGS__
+
+#define TRACE_EVENT(name, proto, args, tstruct, assign, print) \
+	static inline void trace_##name(proto) { }
+#define DECLARE_EVENT_CLASS(name, proto, args, tstruct, assign, print)
+#define DEFINE_EVENT(template, name, proto, args) \
+	static inline void trace_##name(proto) { }
+
+#endif /* __SHIM_TRACEPOINT_H__ */
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-2.0
+//
+// Counting fake regmap. Every call is one I2C message. Without a simulator
+// attached to the amp nothing is stored and reads return zero, which the
+// driver sees as "no faults"; with one, accesses go to the register model in
+// sim.c. Simulated time is advanced by the bus time of each message at
+// bench_bus_hz so the driver's own latency accounting stays meaningful.
+
+#include "harness.h"
+#include "sim.h"
+
+#define TAS5805M_REG_PAGE	0x00
+#define TAS5805M_REG_BOOK	0x7f
+
+struct regmap {
+	struct i2c_client	*i2c;
+	struct tas5805m_sim	*sim;
+};
+
+struct bench_bus bench_bus;
+unsigned long bench_bus_hz = 400000;
+
+/* Bus clocks for a message: START, 9 clocks per byte (8 data + ACK) for the
+ * address byte and every payload byte, STOP. Reads add a repeated START and
+ * a second address byte.
+ */
+#define I2C_MSG_BITS(payload)	(1 + 9 * (1 + (payload)) + 1)
+
+void bench_bus_reset(void)
+{
+	memset(&bench_bus, 0, sizeof(bench_bus));
+}
+
+u64 bench_bus_time_ns(const struct bench_bus *bus, unsigned long hz)
+{
+	return bus->bits * 1000000000ULL / hz;
+}
+
+static void account(unsigned int reg, size_t payload, u64 bits)
+{
+	bench_bus.xfers++;
+	bench_bus.bytes += payload;
+	bench_bus.bits += bits;
+	if (reg == TAS5805M_REG_PAGE || reg == TAS5805M_REG_BOOK)
+		bench_bus.page_selects++;
+
+	shim_time_ns += bits * 1000000000ULL / bench_bus_hz;
+}
+
+struct regmap *devm_regmap_init_i2c(struct i2c_client *i2c, const struct regmap_config *config)
+{
+	struct regmap *map = calloc(1, sizeof(*map));
+
+	if (!map)
+		return ERR_PTR(-ENOMEM);
+
+	map->i2c = i2c;
+	map->sim = container_of(i2c, struct bench_amp, client)->sim;
+	return map;
+}
+
+int regmap_write(struct regmap *map, unsigned int reg, unsigned int val)
+{
+	u8 byte = val;
+
+	bench_bus.writes++;
+	account(reg, 2, I2C_MSG_BITS(2));
+	return map->sim ? tas5805m_sim_write(map->sim, reg, &byte, 1) : 0;
+}
+
+int regmap_bulk_write(struct regmap *map, unsigned int reg, const void *val, size_t count)
+{
+	bench_bus.bulk_writes++;
+	account(reg, 1 + count, I2C_MSG_BITS(1 + count));
+	return map->sim ? tas5805m_sim_write(map->sim, reg, val, count) : 0;
+}
+
+int regmap_raw_write(struct regmap *map, unsigned int reg, const void *val, size_t len)
+{
+	return regmap_bulk_write(map, reg, val, len);
+}
+
+int regmap_read(struct regmap *map, unsigned int reg, unsigned int *val)
+{
+	u8 byte = 0;
+	int ret = 0;
+
+	bench_bus.reads++;
+	account(reg, 2, I2C_MSG_BITS(1) + I2C_MSG_BITS(1) - 1);
+	if (map->sim)
+		ret = tas5805m_sim_read(map->sim, reg, &byte, 1);
+	*val = byte;
+	return ret;
+}
+
+int regmap_bulk_read(struct regmap *map, unsigned int reg, void *val, size_t count)
+{
+	bench_bus.reads++;
+	account(reg, 1 + count, I2C_MSG_BITS(1) + I2C_MSG_BITS(count) - 1);
+	memset(val, 0, count);
+	return map->sim ? tas5805m_sim_read(map->sim, reg, val, count) : 0;
+}
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: GPL-2.0
+//
+// tas5805m-replay: feeds a write-stream capture taken through the driver's
+// debugfs "record" file into the counting fake regmap and the register
+// model, and reports the bus load it represents.
+//
+// Besides the totals, each capture is replayed against an ideal bus at
+// 100 kHz, 400 kHz and 1 MHz with the recorded timestamps as release times,
+// to show how busy the bus would be and how far transfers would fall behind
+// the recorded timeline.
+
+#include <getopt.h>
+
+#include "harness.h"
+#include "sim.h"
+
+/* Capture format, see struct tas5805m_rec_header in tas5805m.c */
+#define REC_MAGIC		"T58R"
+#define REC_VERSION		1
+#define REC_CONT		BIT(31)
+
+struct rec_header {
+	char			magic[4];
+	u8			version;
+	u8			addr;
+	__le16			entry_size;
+	__le32			count;
+	__le32			lost;
+} __packed;
+
+struct rec_entry {
+	__le32			time_us;
+	u8			book;
+	u8			page;
+	u8			reg;
+	u8			val;
+} __packed;
+
+/* One I2C write rebuilt from consecutive entries */
+struct xfer {
+	u64			time_ns;
+	u8			book;
+	u8			page;
+	u8			reg;
+	u8			len;
+	u8			val[128];
+};
+
+static const unsigned long bus_speeds[] = { 100000, 400000, 1000000 };
+
+struct timeline {
+	u64			busy_ns;
+	u64			free_ns;	/* When the bus is next idle */
+	u64			max_lag_ns;	/* Worst delay past the recorded time */
+};
+
+static void timeline_add(struct timeline *tl, const struct xfer *x, unsigned long hz)
+{
+	u64 bits = 1 + 9 * (2 + x->len) + 1;	/* START, address, reg, data, STOP */
+	u64 dur = bits * 1000000000ULL / hz;
+	u64 start = max(x->time_ns, tl->free_ns);
+
+	tl->max_lag_ns = max(tl->max_lag_ns, start - x->time_ns);
+	tl->busy_ns += dur;
+	tl->free_ns = start + dur;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"Usage: %s [-d] capture.bin...\n"
+		"  -d  dump the register model after each capture\n", prog);
+}
+
+static int replay(const char *path, bool dump)
+{
+	struct timeline tl[ARRAY_SIZE(bus_speeds)] = { 0 };
+	struct rec_header hdr;
+	struct bench_amp amp;
+	struct regmap *map;
+	struct rec_entry e;
+	struct xfer x = { 0 };
+	u64 base_ns = 0, last_us = 0, end_ns = 0;
+	u32 i, count;
+	bool first = true;
+	FILE *f;
+
+	f = fopen(path, "rb");
+	if (!f) {
+		perror(path);
+		return -1;
+	}
+
+	if (fread(&hdr, sizeof(hdr), 1, f) != 1 ||
+	    memcmp(hdr.magic, REC_MAGIC, sizeof(hdr.magic)) ||
+	    hdr.version != REC_VERSION ||
+	    le16_to_cpu(hdr.entry_size) != sizeof(e)) {
+		fprintf(stderr, "%s: not a tas5805m capture\n", path);
+		fclose(f);
+		return -1;
+	}
+
+	count = le32_to_cpu(hdr.count);
+
+	bench_amp_init(&amp, hdr.addr);
+	amp.sim = malloc(sizeof(*amp.sim));
+	if (!amp.sim) {
+		fclose(f);
+		return -1;
+	}
+	tas5805m_sim_reset(amp.sim);
+	map = devm_regmap_init_i2c(&amp.client, NULL);
+	bench_bus_reset();
+
+	for (i = 0; i <= count; i++) {
+		bool have = i < count && fread(&e, sizeof(e), 1, f) == 1;
+		u32 t = have ? le32_to_cpu(e.time_us) : 0;
+
+		/* Flush the pending transfer unless this entry continues it */
+		if (x.len && (!have || !(t & REC_CONT) || x.len == sizeof(x.val))) {
+			for (unsigned int s = 0; s < ARRAY_SIZE(bus_speeds); s++)
+				timeline_add(&tl[s], &x, bus_speeds[s]);
+
+			if (shim_time_ns < x.time_ns)
+				shim_time_ns = x.time_ns;
+			if (x.len == 1)
+				regmap_write(map, x.reg, x.val[0]);
+			else
+				regmap_bulk_write(map, x.reg, x.val, x.len);
+			x.len = 0;
+		}
+
+		if (!have)
+			break;
+
+		if (!(t & REC_CONT) || !x.len) {
+			/* The capture may start on any page: select it silently */
+			if (first) {
+				amp.sim->book = e.book;
+				amp.sim->page = e.page;
+				first = false;
+			}
+
+			/* Timestamps are 31 bits and wrap after ~35 minutes */
+			t &= ~REC_CONT;
+			if (t < last_us)
+				base_ns += (u64)REC_CONT * 1000;
+			last_us = t;
+
+			x.time_ns = base_ns + (u64)t * 1000;
+			x.book = e.book;
+			x.page = e.page;
+			x.reg = e.reg;
+			end_ns = x.time_ns;
+		}
+
+		if (amp.sim->book != e.book || amp.sim->page != e.page)
+			fprintf(stderr, "%s: entry %u: recorded book 0x%02x page 0x%02x, model has 0x%02x/0x%02x\n",
+				path, i, e.book, e.page, amp.sim->book, amp.sim->page);
+
+		x.val[x.len++] = e.val;
+	}
+	fclose(f);
+
+	printf("%s: amp 0x%02x, %u entries (%u lost), %.2f ms recorded\n",
+	       path, hdr.addr, count, le32_to_cpu(hdr.lost), end_ns / 1e6);
+	printf("  %llu xfers (%llu single, %llu bulk), %llu bytes, %llu page selects\n",
+	       bench_bus.xfers, bench_bus.writes, bench_bus.bulk_writes,
+	       bench_bus.bytes, bench_bus.page_selects);
+	for (unsigned int s = 0; s < ARRAY_SIZE(bus_speeds); s++)
+		printf("  %7lu Hz: bus busy %10.2f ms (%5.1f%%), max lag %10.2f ms\n",
+		       bus_speeds[s], tl[s].busy_ns / 1e6,
+		       end_ns ? 100.0 * tl[s].busy_ns / max(end_ns, tl[s].free_ns) : 100.0,
+		       tl[s].max_lag_ns / 1e6);
+
+	if (amp.sim->stats.unmapped || amp.sim->stats.readonly_writes || amp.sim->stats.overruns)
+		printf("  %llu unmapped, %llu read-only writes, %llu page overruns\n",
+		       amp.sim->stats.unmapped, amp.sim->stats.readonly_writes,
+		       amp.sim->stats.overruns);
+
+	printf("  image %08x, %llu state changes, %llu fault clears\n",
+	       tas5805m_sim_digest(amp.sim), amp.sim->stats.state_changes,
+	       amp.sim->stats.fault_clears);
+
+	if (dump)
+		tas5805m_sim_dump(amp.sim);
+
+	free(amp.sim);
+	free(map);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	bool dump = false;
+	int opt, ret = 0;
+
+	while ((opt = getopt(argc, argv, "dh")) != -1) {
+		switch (opt) {
+		case 'd':
+			dump = true;
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (optind == argc) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	for (; optind < argc; optind++)
+		ret |= replay(argv[optind], dump);
+
+	return ret ? 1 : 0;
+}
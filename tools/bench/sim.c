@@ -0,0 +1,315 @@
+// SPDX-License-Identifier: GPL-2.0
+//
+// Register-level model of the TAS5805M control port, see sim.h.
+
+#include <linux/types.h>
+#include <linux/string.h>
+#include <linux/errno.h>
+#include <linux/kernel.h>
+
+#include "tas5805m.h"
+#include "sim.h"
+
+/* Registers with no storage behind them on the control port page */
+#define TAS5805M_REG_FS_MON		0x37
+#define TAS5805M_REG_BCK_MON		0x38
+#define TAS5805M_REG_DIE_ID		0x67
+
+#define TAS5805M_DIE_ID			0x95
+
+/* Biquad coefficient book, TAS5805M_REG_BOOK_EQ in eq/tas5805m_eq.h */
+#define TAS5805M_BOOK_EQ		0xaa
+
+/* Reset values of the page-0 registers the driver uses, everything else
+ * resets to zero.
+ */
+static const u8 tas5805m_sim_defaults[][2] = {
+	{ TAS5805M_REG_DEVICE_CTRL_2,	TAS5805M_DCTRL2_DIS_DSP },
+	{ 0x33,				0x02 },	/* SAP_CTRL1: 24-bit I2S */
+	{ 0x35,				0x11 },	/* SAP_CTRL3: L to left, R to right */
+	{ TAS5805M_REG_VOL_CTRL,	TAS5805M_VOLUME_ZERO_DB },
+	{ 0x4e,				0x33 },	/* DIG_VOL_CTRL2: ramp rates */
+	{ TAS5805M_REG_AUTO_MUTE_CTRL,	TAS5805M_AUTO_MUTE_BOTH },
+};
+
+static const u8 tas5805m_sim_books[TAS5805M_SIM_BOOKS] = {
+	TAS5805M_BOOK_CONTROL_PORT, TAS5805M_BOOK_4, TAS5805M_BOOK_5,
+	TAS5805M_BOOK_EQ,
+};
+
+static int tas5805m_sim_book_index(unsigned int book)
+{
+	int i;
+
+	for (i = 0; i < TAS5805M_SIM_BOOKS; i++)
+		if (tas5805m_sim_books[i] == book)
+			return i;
+
+	return -1;
+}
+
+bool tas5805m_sim_book_modelled(unsigned int book)
+{
+	return tas5805m_sim_book_index(book) >= 0;
+}
+
+static bool tas5805m_sim_on_control_page(const struct tas5805m_sim *sim)
+{
+	return sim->book == TAS5805M_BOOK_CONTROL_PORT &&
+	       sim->page == TAS5805M_REG_PAGE_0;
+}
+
+static void tas5805m_sim_reset_control_port(struct tas5805m_sim *sim)
+{
+	u8 *regs = sim->mem[0][TAS5805M_REG_PAGE_0];
+	unsigned int i;
+
+	memset(regs, 0, TAS5805M_SIM_PAGE_SIZE);
+	for (i = 0; i < ARRAY_SIZE(tas5805m_sim_defaults); i++)
+		regs[tas5805m_sim_defaults[i][0]] = tas5805m_sim_defaults[i][1];
+
+	sim->book = TAS5805M_BOOK_CONTROL_PORT;
+	sim->page = TAS5805M_REG_PAGE_0;
+}
+
+/* DSP reset: coefficient RAM back to zero */
+static void tas5805m_sim_reset_dsp(struct tas5805m_sim *sim)
+{
+	memset(sim->mem[1], 0, sizeof(sim->mem) - sizeof(sim->mem[0]));
+}
+
+void tas5805m_sim_reset(struct tas5805m_sim *sim)
+{
+	memset(sim, 0, sizeof(*sim));
+	tas5805m_sim_reset_control_port(sim);
+}
+
+unsigned int tas5805m_sim_power_state(const struct tas5805m_sim *sim)
+{
+	return sim->mem[0][TAS5805M_REG_PAGE_0][TAS5805M_REG_DEVICE_CTRL_2] & 0x3;
+}
+
+void tas5805m_sim_inject_fault(struct tas5805m_sim *sim, u8 chan, u8 global1,
+			       u8 global2, u8 ot_warning)
+{
+	sim->chan_fault |= chan;
+	sim->global_fault1 |= global1;
+	sim->global_fault2 |= global2;
+	sim->ot_warning |= ot_warning;
+}
+
+u8 tas5805m_sim_peek(const struct tas5805m_sim *sim, unsigned int book,
+		     unsigned int page, unsigned int reg)
+{
+	int index = tas5805m_sim_book_index(book);
+
+	if (index < 0 || page >= TAS5805M_SIM_PAGES || reg >= TAS5805M_SIM_PAGE_SIZE)
+		return 0;
+
+	return sim->mem[index][page][reg];
+}
+
+u32 tas5805m_sim_digest(const struct tas5805m_sim *sim)
+{
+	const u8 *p = (const u8 *)sim->mem;
+	u32 hash = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < sizeof(sim->mem); i++)
+		hash = (hash ^ p[i]) * 16777619u;
+
+	return hash;
+}
+
+void tas5805m_sim_dump(const struct tas5805m_sim *sim)
+{
+	unsigned int b, page, reg;
+
+	for (b = 0; b < TAS5805M_SIM_BOOKS; b++) {
+		for (page = 0; page < TAS5805M_SIM_PAGES; page++) {
+			bool header = false;
+
+			for (reg = 1; reg < TAS5805M_SIM_PAGE_SIZE; reg++) {
+				u8 val = sim->mem[b][page][reg];
+
+				/* Book select, not storage, on page 0 */
+				if (!val || (page == 0 && reg == TAS5805M_REG_BOOK_SET))
+					continue;
+
+				if (!header) {
+					printf("  book 0x%02x page 0x%02x:",
+					       tas5805m_sim_books[b], page);
+					header = true;
+				}
+				printf(" %02x=%02x", reg, val);
+			}
+
+			if (header)
+				putchar('\n');
+		}
+	}
+}
+
+/* Page-0 control port registers with side effects. Returns true if the
+ * write was fully handled here.
+ */
+static bool tas5805m_sim_write_control(struct tas5805m_sim *sim,
+				       unsigned int reg, u8 val)
+{
+	u8 *regs = sim->mem[0][TAS5805M_REG_PAGE_0];
+
+	switch (reg) {
+	case TAS5805M_REG_RESET_CTRL:
+		/* Self-clearing */
+		if (val & TAS5805M_RESET_DSP)
+			tas5805m_sim_reset_dsp(sim);
+		if (val & TAS5805M_RESET_CONTROL_PORT)
+			tas5805m_sim_reset_control_port(sim);
+		return true;
+
+	case TAS5805M_REG_DEVICE_CTRL_2:
+		if ((val & 0x3) != (regs[reg] & 0x3))
+			sim->stats.state_changes++;
+		return false;
+
+	case TAS5805M_REG_FAULT:
+		if (val & TAS5805M_ANALOG_FAULT_CLEAR) {
+			sim->chan_fault = 0;
+			sim->global_fault1 = 0;
+			sim->global_fault2 = 0;
+			sim->ot_warning = 0;
+			sim->stats.fault_clears++;
+		}
+		return true;
+
+	case TAS5805M_REG_FS_MON:
+	case TAS5805M_REG_BCK_MON:
+	case TAS5805M_REG_CLKDET_STATUS:
+	case TAS5805M_REG_DIE_ID:
+	case TAS5805M_REG_POWER_STATE:
+	case TAS5805M_REG_AUTOMUTE_STATE:
+	case TAS5805M_REG_CHAN_FAULT:
+	case TAS5805M_REG_GLOBAL_FAULT1:
+	case TAS5805M_REG_GLOBAL_FAULT2:
+	case TAS5805M_REG_OT_WARNING:
+		sim->stats.readonly_writes++;
+		return true;
+	}
+
+	return false;
+}
+
+static u8 tas5805m_sim_read_control(struct tas5805m_sim *sim, unsigned int reg)
+{
+	switch (reg) {
+	case TAS5805M_REG_DIE_ID:
+		return TAS5805M_DIE_ID;
+	case TAS5805M_REG_POWER_STATE:
+		return tas5805m_sim_power_state(sim);
+	case TAS5805M_REG_AUTOMUTE_STATE:
+		return sim->silent ? TAS5805M_AUTOMUTE_BOTH : 0;
+	case TAS5805M_REG_CHAN_FAULT:
+		return sim->chan_fault;
+	case TAS5805M_REG_GLOBAL_FAULT1:
+		return sim->global_fault1;
+	case TAS5805M_REG_GLOBAL_FAULT2:
+		return sim->global_fault2;
+	case TAS5805M_REG_OT_WARNING:
+		return sim->ot_warning | (sim->hot ? TAS5805M_OT_WARNING : 0);
+	case TAS5805M_REG_FAULT:
+	case TAS5805M_REG_RESET_CTRL:
+		return 0;
+	}
+
+	return sim->mem[0][TAS5805M_REG_PAGE_0][reg];
+}
+
+static void tas5805m_sim_write_one(struct tas5805m_sim *sim, unsigned int reg, u8 val)
+{
+	int index;
+
+	/* Register 0 selects the page everywhere, register 0x7f selects the
+	 * book only on page 0 and is plain coefficient storage elsewhere.
+	 */
+	if (reg == TAS5805M_REG_PAGE_SET) {
+		sim->page = val;
+		sim->stats.page_selects++;
+		return;
+	}
+
+	if (reg == TAS5805M_REG_BOOK_SET && sim->page == TAS5805M_REG_PAGE_0) {
+		sim->book = val;
+		sim->stats.book_selects++;
+		return;
+	}
+
+	if (tas5805m_sim_on_control_page(sim) &&
+	    tas5805m_sim_write_control(sim, reg, val))
+		return;
+
+	index = tas5805m_sim_book_index(sim->book);
+	if (index < 0) {
+		sim->stats.unmapped++;
+		return;
+	}
+
+	sim->mem[index][sim->page][reg] = val;
+}
+
+static u8 tas5805m_sim_read_one(struct tas5805m_sim *sim, unsigned int reg)
+{
+	int index;
+
+	if (reg == TAS5805M_REG_PAGE_SET)
+		return sim->page;
+
+	if (reg == TAS5805M_REG_BOOK_SET && sim->page == TAS5805M_REG_PAGE_0)
+		return sim->book;
+
+	if (tas5805m_sim_on_control_page(sim))
+		return tas5805m_sim_read_control(sim, reg);
+
+	index = tas5805m_sim_book_index(sim->book);
+	if (index < 0) {
+		sim->stats.unmapped++;
+		return 0;
+	}
+
+	return sim->mem[index][sim->page][reg];
+}
+
+int tas5805m_sim_write(struct tas5805m_sim *sim, unsigned int reg,
+		       const u8 *val, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++, reg++) {
+		if (reg >= TAS5805M_SIM_PAGE_SIZE) {
+			sim->stats.overruns++;
+			return -EINVAL;
+		}
+
+		tas5805m_sim_write_one(sim, reg, val[i]);
+		sim->stats.writes++;
+	}
+
+	return 0;
+}
+
+int tas5805m_sim_read(struct tas5805m_sim *sim, unsigned int reg,
+		      u8 *val, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++, reg++) {
+		if (reg >= TAS5805M_SIM_PAGE_SIZE) {
+			sim->stats.overruns++;
+			return -EINVAL;
+		}
+
+		val[i] = tas5805m_sim_read_one(sim, reg);
+		sim->stats.reads++;
+	}
+
+	return 0;
+}
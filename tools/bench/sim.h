@@ -0,0 +1,81 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * sim.h - Register-level model of the TAS5805M control port.
+ *
+ * The model keeps the book/page select state, the page-0 control registers
+ * with their reset values, the fault registers with clear-on-write semantics
+ * and the coefficient RAM of books 0x78, 0x8c and 0xaa. Multi-byte accesses
+ * auto-increment the register address within the current page, as the
+ * device does.
+ *
+ * The core only uses basic kernel types and the driver's register header,
+ * so it builds both in the host harness and in a kernel test module that
+ * backs a regmap with it.
+ */
+
+#ifndef __TAS5805M_SIM_H__
+#define __TAS5805M_SIM_H__
+
+#define TAS5805M_SIM_BOOKS		4	/* Control port, 0x78, 0x8c, 0xaa */
+#define TAS5805M_SIM_PAGES		256
+#define TAS5805M_SIM_PAGE_SIZE		128
+
+/* Protocol errors and events seen by the model */
+struct tas5805m_sim_stats {
+	u64			writes;		/* Data bytes written */
+	u64			reads;		/* Data bytes read */
+	u64			book_selects;
+	u64			page_selects;
+	u64			unmapped;	/* Accesses to books not modelled */
+	u64			readonly_writes;
+	u64			overruns;	/* Auto-increment past the end of a page */
+	u64			fault_clears;
+	u64			state_changes;	/* DEVICE_CTRL_2 power state transitions */
+};
+
+struct tas5805m_sim {
+	u8			book;
+	u8			page;
+	u8			mem[TAS5805M_SIM_BOOKS][TAS5805M_SIM_PAGES][TAS5805M_SIM_PAGE_SIZE];
+
+	/* Latched fault bits, cleared by writing ANALOG_FAULT_CLEAR */
+	u8			chan_fault;
+	u8			global_fault1;
+	u8			global_fault2;
+	u8			ot_warning;
+
+	/* Die above the warning temperature: the warning reads as set
+	 * however often it is cleared
+	 */
+	bool			hot;
+
+	/* Input is digital zero: both channels read as auto-muted */
+	bool			silent;
+
+	struct tas5805m_sim_stats stats;
+};
+
+void tas5805m_sim_reset(struct tas5805m_sim *sim);
+int tas5805m_sim_write(struct tas5805m_sim *sim, unsigned int reg,
+		       const u8 *val, size_t len);
+int tas5805m_sim_read(struct tas5805m_sim *sim, unsigned int reg,
+		      u8 *val, size_t len);
+
+/* Direct access for checks and dumps, bypassing the select state */
+bool tas5805m_sim_book_modelled(unsigned int book);
+u8 tas5805m_sim_peek(const struct tas5805m_sim *sim, unsigned int book,
+		     unsigned int page, unsigned int reg);
+
+/* FNV-1a digest of the whole register image */
+u32 tas5805m_sim_digest(const struct tas5805m_sim *sim);
+/* Print the non-zero registers of every modelled book, one page per line */
+void tas5805m_sim_dump(const struct tas5805m_sim *sim);
+
+/* Latch fault bits as the device would on an event */
+void tas5805m_sim_inject_fault(struct tas5805m_sim *sim, u8 chan, u8 global1,
+			       u8 global2, u8 ot_warning);
+
+/* DEVICE_CTRL_2 power state: deep sleep, sleep, HiZ or play */
+unsigned int tas5805m_sim_power_state(const struct tas5805m_sim *sim);
+
+#endif /* __TAS5805M_SIM_H__ */